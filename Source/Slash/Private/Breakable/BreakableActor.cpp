@@ -5,6 +5,8 @@
 #include "GeometryCollection/GeometryCollectionComponent.h"
 #include "Item/Treasure.h"
 #include "Components/CapsuleComponent.h"
+#include "Combat/CombatSpatialHash.h"
+#include "Pool/ActorPoolSubsystem.h"
 
 ABreakableActor::ABreakableActor()
 {
@@ -26,6 +28,19 @@ void ABreakableActor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->RegisterActor(this, ECombatActorType::ECAT_Breakable);
+	}
+}
+
+void ABreakableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
 void ABreakableActor::Tick(float DeltaTime)
@@ -38,13 +53,13 @@ void ABreakableActor::GetHit_Implementation(const FVector& ImpactPoint, AActor*
 {
 	if (bBroken) return;
 	bBroken = true;
-	UWorld* World = GetWorld();
-	if (World && TreasureClasses.Num() > 0)
+	UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+	if (Pool && TreasureClasses.Num() > 0)
 	{
 		FVector Location = GetActorLocation();
 		Location.Z += 75.f;
 
 		const int32 Selection = FMath::RandRange(0, TreasureClasses.Num() - 1);
-		World->SpawnActor<ATreasure>(TreasureClasses[Selection], Location, GetActorRotation());
+		Pool->Acquire<ATreasure>(TreasureClasses[Selection], FTransform(GetActorRotation(), Location));
 	}
 }
@@ -5,13 +5,36 @@
 #include "Components/BoxComponent.h"
 #include "Components/AttributeComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "NiagaraFunctionLibrary.h"
 #include "Item/Weapons/Weapon.h"
 #include "Components/CapsuleComponent.h"
 #include "HUD/SlashOverlay.h"
+#include "Combat/CombatSpatialHash.h"
+#include "Combat/ImpactEffectSubsystem.h"
 
 #include "Slash/DebugMacros.h"
 
-ABaseCharacter::ABaseCharacter()
+namespace CombatantTags
+{
+	/* ECombatantFlags 와 같은 이름의 블루프린트 호환 태그 */
+	static const FName Enemy(TEXT("Enemy"));
+	static const FName EngageableTarget(TEXT("EngageableTarget"));
+	static const FName Dead(TEXT("Dead"));
+}
+
+namespace HitReactSections
+{
+	/* 피격 몽타주 섹션 (인덱스 = 섹션 캐시 인덱스) */
+	enum : int32 { FromFront, FromBack, FromLeft, FromRight };
+	static const FName Names[] = { TEXT("FromFront"), TEXT("FromBack"), TEXT("FromLeft"), TEXT("FromRight") };
+
+	/* 방향 경계 (±45°, ±135°) 의 코사인 */
+	static constexpr double Cos45 = UE_DOUBLE_HALF_SQRT_2;
+	static constexpr double Cos135 = -UE_DOUBLE_HALF_SQRT_2;
+}
+
+ABaseCharacter::ABaseCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = true;
 	// Attribute = CreateDefaultSubobject<UAttributeComponent>(TEXT("Attributes"));
@@ -21,9 +44,19 @@ ABaseCharacter::ABaseCharacter()
 void ABaseCharacter::BeginPlay()
 {
 	Super::BeginPlay();
+	BuildMontageSectionCaches();
 	
 }
 
+void ABaseCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
 void ABaseCharacter::GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter)
 {
 	if (IsAlive() && Hitter)
@@ -38,7 +71,7 @@ void ABaseCharacter::GetHit_Implementation(const FVector& ImpactPoint, AActor* H
 
 void ABaseCharacter::Attack()
 {
-	if (CombatTarget && CombatTarget->ActorHasTag(FName("Dead")))
+	if (EnumHasAnyFlags(GetActorCombatantFlags(CombatTarget), ECombatantFlags::ECF_Dead))
 	{
 		CombatTarget = nullptr;
 	}
@@ -46,7 +79,7 @@ void ABaseCharacter::Attack()
 
 void ABaseCharacter::Die()
 {
-	Tags.Add(FName("Dead"));
+	SetCombatantFlags(ECombatantFlags::ECF_Dead, true);
 	PlayDeathMontage();
 }
 
@@ -54,93 +87,105 @@ void ABaseCharacter::PlayHitAttackMontage()
 {
 }
 
-void ABaseCharacter::PlayHitReactMontage(const FName& SectionName)
+void ABaseCharacter::PlayHitReactMontage(int32 SectionIndex)
 {
-	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && HitReactMontage)
-	{
-		AnimInstance->Montage_Play(HitReactMontage);
-		AnimInstance->Montage_JumpToSection(SectionName, HitReactMontage);
-	}
+	HitReactSectionCache.Play(GetMesh()->GetAnimInstance(), SectionIndex);
 }
 
 void ABaseCharacter::DirectionalHitReact(const FVector& ImpactPoint)
 {
-	/**
-	 * 맞은 방향을 계산하여 피격 리액션 방향을 판별하는 절차:
-	 * 1. Enemy의 전방 벡터(Forward Vector)를 구한다
-	 * 2. 피격된 지점(ImpactPoint)과 Enemy 위치를 기준으로 ToHit 방향 벡터를 구한다
-	 * 3. ToHit과 전방 벡터 사이의 내적(Dot Product)을 계산해 앞/뒤 여부를 판단한다
-	 * 4. 이후 필요 시 오른쪽 벡터(Right Vector)로 좌/우 여부도 판단한다
-	 */
-
-	// 1. Enemy의 전방 벡터 (월드 좌표 기준)
-	const FVector Forward = GetActorForwardVector();
-
-	// 2. 피격 지점의 Z값을 그대로 유지 (현재는 그대로 사용 중)
 	const FVector ImpactLowered(ImpactPoint.X, ImpactPoint.Y, GetActorLocation().Z);
-
-	// 3. ToHit 벡터 = Enemy → 피격 지점 방향 :: “적 → 공격자” 방향 벡터
 	const FVector ToHit = (ImpactLowered - GetActorLocation()).GetSafeNormal();
 
-	// 4. 전방 벡터와 ToHit 벡터의 내적 계산 → 방향 간 각도를 구하는 데 사용 :: 내적 (Dot Product) 구하기
-	// CosTheta가 1이면 → 정면에서 맞음
-	// CosTheta가 -1이면 → 뒤에서 맞음
-	// CosTheta가 0이면 → 옆(왼쪽 또는 오른쪽)에서 맞음
-	const double CosTheta = FVector::DotProduct(Forward, ToHit);
-
-	// 5. 내적 값의 절댓값을 이용해 실제 각도 계산 (0도 = 완전 정면, 180도 = 정반대)
-	double Theta = FMath::Acos(CosTheta);
-	Theta = FMath::RadiansToDegrees(Theta);
-
-	// Forward(적 전방 벡터)와 ToHit(공격 지점 방향 벡터)의 외적을 통해 회전 방향(좌/우)을 판단
-	const FVector CrossProduct = FVector::CrossProduct(Forward, ToHit);
+	PlayHitReactMontage(ClassifyHitReactDirection(GetActorForwardVector(), ToHit));
+}
 
-	// Z값이 음수이면 공격자가 적의 왼쪽에서 공격해온 것 → Theta를 음수로 바꿔 왼쪽임을 표현
-	if (CrossProduct.Z < 0)
-	{
-		// 각도를 음수로 바꿔서 왼쪽에서 맞았음을 나타냄
-		Theta *= -1.f;
-	}
+int32 ABaseCharacter::ClassifyHitReactDirection(const FVector& Forward, const FVector& ToHit)
+{
+	/**
+	 * 맞은 방향을 각도 없이 내적 값만으로 판별하는 절차:
+	 * 1. 전방 벡터와 ToHit(적 → 공격자, 수평) 벡터의 내적 CosTheta 를 구한다
+	 * 2. 외적의 Z 성분(SideSign)으로 좌/우를 구한다 (음수면 왼쪽)
+	 * 3. CosTheta 를 cos(45°), cos(135°) 와 비교한다 (Acos 로 각도를 구해 ±45°/±135° 와 비교하던 것과 같은 경계)
+	 *    - 정면: |Theta| < 45 (왼쪽은 -45 포함)  → CosTheta > cos45 (왼쪽은 >=)
+	 *    - 왼쪽: -135 <= Theta < -45             → cos135 <= CosTheta < cos45
+	 *    - 오른쪽: 45 <= Theta < 135              → cos135 < CosTheta <= cos45
+	 *    - 나머지는 뒤
+	 */
+	const double CosTheta = FVector::DotProduct(Forward, ToHit);
+	const double SideSign = Forward.X * ToHit.Y - Forward.Y * ToHit.X;
+	const bool bFromLeft = SideSign < 0.0;
 
-	FName SectionName("FromBack");
-	
-	if (Theta >= -45.f && Theta < 45.f)
+	int32 Section = HitReactSections::FromBack;
+	if (bFromLeft)
 	{
-		SectionName = FName("FromFront");
+		if (CosTheta >= HitReactSections::Cos45) Section = HitReactSections::FromFront;
+		else if (CosTheta >= HitReactSections::Cos135) Section = HitReactSections::FromLeft;
 	}
-	else if (Theta >= -135.f && Theta < -45.f)
-	{
-		SectionName = FName("FromLeft");
-	}else if (Theta >= 45.f && Theta < 135.f)
+	else
 	{
-		SectionName = FName("FromRight");
+		if (CosTheta > HitReactSections::Cos45) Section = HitReactSections::FromFront;
+		else if (CosTheta > HitReactSections::Cos135) Section = HitReactSections::FromRight;
 	}
 
-	PlayHitReactMontage(SectionName);
+	return Section;
 }
 
 /**
- * 지정된 위치에서 Hit 사운드를 재생합니다.
+ * 지정된 위치에서 Hit 사운드를 재생합니다. (UImpactEffectSubsystem 의 프레임 예산 안에서)
  *
  * @param ImpactPoint 사운드가 재생될 충돌 지점의 위치를 나타내는 벡터
  */
 void ABaseCharacter::PlayHitSound(const FVector& ImpactPoint)
 {
-	if (HitSound)
+	if (HitSound == nullptr) return;
+
+	if (UImpactEffectSubsystem* ImpactEffects = GetWorld()->GetSubsystem<UImpactEffectSubsystem>())
+	{
+		ImpactEffects->QueueSound(HitSound, ImpactPoint);
+	}
+	else
 	{
 		UGameplayStatics::PlaySoundAtLocation(this, HitSound, ImpactPoint);
 	}
 }
 
 /**
- * 지정된 위치에서 충돌 입자 효과를 생성합니다.
+ * 지정된 위치에서 충돌 입자 효과를 생성합니다. (UImpactEffectSubsystem 의 프레임 예산 안에서)
  *
  * @param ImpactPoint 입자 효과가 나타날 충돌 지점의 위치를 나타내는 벡터
  */
 void ABaseCharacter::SpawnHitParticles(const FVector& ImpactPoint)
 {
-	if (HitParticles && GetWorld())
+	if (GetWorld() == nullptr) return;
+
+	UImpactEffectSubsystem* ImpactEffects = GetWorld()->GetSubsystem<UImpactEffectSubsystem>();
+
+	/* 캐릭터에 지정된 시스템이 없으면 프로젝트 기본 일괄 피격 이펙트 */
+	UNiagaraSystem* ImpactSystem = HitImpactSystem;
+	if (ImpactSystem == nullptr && ImpactEffects)
+	{
+		ImpactSystem = ImpactEffects->GetDefaultHitImpactSystem();
+	}
+	if (ImpactSystem)
+	{
+		if (ImpactEffects)
+		{
+			ImpactEffects->QueueBatchedNiagara(ImpactSystem, ImpactPoint);
+		}
+		else
+		{
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ImpactSystem, ImpactPoint);
+		}
+		return;
+	}
+
+	if (HitParticles == nullptr) return;
+	if (ImpactEffects)
+	{
+		ImpactEffects->QueueParticles(HitParticles, ImpactPoint);
+	}
+	else
 	{
 		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), HitParticles, ImpactPoint);
 	}
@@ -155,19 +200,17 @@ void ABaseCharacter::HandleDamage(float DamageAmount)
 }
 
 /**
- * 지정된 섹션에서 주어진 몽타주를 재생합니다.
- *
- * @param Montage 재생할 애니메이션 몽타주
- * @param SectionName 재생할 섹션의 이름
+ * 몽타주마다 섹션 이름을 한 번만 찾아 시작 시간을 캐시합니다.
+ * 없는 섹션은 여기서 경고로 알려 줍니다.
  */
-void ABaseCharacter::PlayMontageSection(UAnimMontage* Montage, const FName& SectionName)
+void ABaseCharacter::BuildMontageSectionCaches()
 {
-	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && Montage)
-	{
-		AnimInstance->Montage_Play(Montage);
-		AnimInstance->Montage_JumpToSection(SectionName, Montage);
-	}
+	static const FName DodgeSectionNames[] = { TEXT("Default") };
+
+	AttackSectionCache.Build(AttackMontage, AttackMontageSection, this);
+	DeathSectionCache.Build(DeathMontage, DeathMontageSection, this);
+	HitReactSectionCache.Build(HitReactMontage, HitReactSections::Names, this);
+	DodgeSectionCache.Build(DodgeMontage, DodgeSectionNames, this);
 }
 
 void ABaseCharacter::DisableCapsule()
@@ -180,25 +223,44 @@ void ABaseCharacter::DisableMeshCollision()
 	GetMesh()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
 
-int32 ABaseCharacter::PlayRandomMontageSection(UAnimMontage* Montage, const TArray<FName>& SectionNames)
+void ABaseCharacter::ResetCharacterState()
 {
-	if (SectionNames.Num() <= 0) return -1;
-	const int32 MaxSectionIndex = SectionNames.Num() - 1;
-	const int32 Selection = FMath::RandRange(0, MaxSectionIndex);
-	const FName& SectionName = SectionNames[Selection];
-	
-	PlayMontageSection(Montage, SectionNames[Selection]);
+	const ABaseCharacter* Defaults = GetClass()->GetDefaultObject<ABaseCharacter>();
+
+	if (Attribute)
+	{
+		Attribute->ResetAttributes();
+	}
+	SetCombatantFlags(ECombatantFlags::ECF_Dead, false);
+	DeathPose = Defaults->DeathPose;
+	CombatTarget = nullptr;
+
+	GetCapsuleComponent()->SetCollisionEnabled(Defaults->GetCapsuleComponent()->GetCollisionEnabled());
+	GetMesh()->SetCollisionEnabled(Defaults->GetMesh()->GetCollisionEnabled());
+
+	if (UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.f);
+	}
+}
+
+int32 ABaseCharacter::PlayRandomMontageSection(const FMontageSectionCache& Sections)
+{
+	if (Sections.Num() <= 0) return -1;
+	const int32 Selection = FMath::RandRange(0, Sections.Num() - 1);
+
+	Sections.Play(GetMesh()->GetAnimInstance(), Selection);
 	return Selection;
 }
 
 int32 ABaseCharacter::PlayAttackMontage()
 {
-	return PlayRandomMontageSection(AttackMontage, AttackMontageSection);
+	return PlayRandomMontageSection(AttackSectionCache);
 }
 
 int32 ABaseCharacter::PlayDeathMontage()
 {
-	const int32 Selection = PlayRandomMontageSection(DeathMontage, DeathMontageSection);
+	const int32 Selection = PlayRandomMontageSection(DeathSectionCache);
 	TEnumAsByte<EDeathPose> Pose(Selection);
 	if (Pose < EDeathPose::EDP_MAX)
 	{
@@ -209,7 +271,7 @@ int32 ABaseCharacter::PlayDeathMontage()
 
 void ABaseCharacter::PlayDodgeMontage()
 {
-	PlayMontageSection(DodgeMontage, FName("Default"));
+	DodgeSectionCache.Play(GetMesh()->GetAnimInstance(), 0);
 }
 
 void ABaseCharacter::StopAttackMontage()
@@ -271,7 +333,53 @@ void ABaseCharacter::SetWeaponCollisionEnabled(ECollisionEnabled::Type Collision
 	if (EquippedWeapon && EquippedWeapon->GetWeaponBox())
 	{
 		EquippedWeapon->GetWeaponBox()->SetCollisionEnabled(CollisionEnabled);
-		EquippedWeapon->IgnoreActors.Empty();
+
+		/* 무기 충돌이 켜져 있는 구간 = 휘두르기 구간 (공격 몽타주 노티파이)
+		 * 맞은 액터 목록은 휘두르기가 시작될 때만 비움 (끝날 때 비우면 아직 결과를 기다리는 트레이스가 같은 대상을 다시 때림)
+		 */
+		if (CollisionEnabled == ECollisionEnabled::NoCollision)
+		{
+			EquippedWeapon->EndSwing();
+		}
+		else
+		{
+			EquippedWeapon->ResetIgnoreActors();
+			EquippedWeapon->BeginSwing();
+		}
 	}
 }
 
+
+ECombatantFlags ABaseCharacter::GetActorCombatantFlags(const AActor* Actor)
+{
+	const ABaseCharacter* Character = Cast<ABaseCharacter>(Actor);
+	return Character ? Character->CombatantFlags : ECombatantFlags::ECF_None;
+}
+
+void ABaseCharacter::SetCombatantFlags(ECombatantFlags Flags, bool bEnabled)
+{
+	if (bEnabled)
+	{
+		CombatantFlags |= Flags;
+	}
+	else
+	{
+		CombatantFlags &= ~Flags;
+	}
+
+	const auto SyncTag = [this, Flags, bEnabled](ECombatantFlags Flag, const FName& Tag)
+	{
+		if (!EnumHasAnyFlags(Flags, Flag)) return;
+		if (bEnabled)
+		{
+			Tags.AddUnique(Tag);
+		}
+		else
+		{
+			Tags.Remove(Tag);
+		}
+	};
+	SyncTag(ECombatantFlags::ECF_Enemy, CombatantTags::Enemy);
+	SyncTag(ECombatantFlags::ECF_EngageableTarget, CombatantTags::EngageableTarget);
+	SyncTag(ECombatantFlags::ECF_Dead, CombatantTags::Dead);
+}
@@ -0,0 +1,43 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Characters/MontageSectionCache.h"
+#include "Animation/AnimMontage.h"
+#include "Animation/AnimInstance.h"
+
+void FMontageSectionCache::Build(UAnimMontage* InMontage, TArrayView<const FName> SectionNames, const UObject* Owner)
+{
+	Montage = InMontage;
+	StartTimes.Reset();
+	if (Montage == nullptr)
+	{
+		/* 몽타주가 없어도 섹션 수는 유지 (무작위 선택 결과로 사망 포즈 등을 정하는 호출자를 위해) */
+		StartTimes.Init(0.f, SectionNames.Num());
+		return;
+	}
+
+	StartTimes.Reserve(SectionNames.Num());
+	for (const FName& SectionName : SectionNames)
+	{
+		const int32 SectionIndex = Montage->GetSectionIndex(SectionName);
+		if (SectionIndex == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: montage %s has no section %s, it will play from the start"),
+				*GetNameSafe(Owner), *Montage->GetName(), *SectionName.ToString());
+			StartTimes.Add(0.f);
+			continue;
+		}
+
+		float StartTime = 0.f;
+		float EndTime = 0.f;
+		Montage->GetSectionStartAndEndTime(SectionIndex, StartTime, EndTime);
+		StartTimes.Add(StartTime);
+	}
+}
+
+bool FMontageSectionCache::Play(UAnimInstance* AnimInstance, int32 SectionIndex) const
+{
+	if (AnimInstance == nullptr || Montage == nullptr || !StartTimes.IsValidIndex(SectionIndex)) return false;
+
+	AnimInstance->Montage_Play(Montage, 1.f, EMontagePlayReturnType::MontageLength, StartTimes[SectionIndex]);
+	return true;
+}
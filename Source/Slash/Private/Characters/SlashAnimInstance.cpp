@@ -4,7 +4,6 @@
 #include "Characters/SlashCharacter.h"
 #include "kismet/KismetMaterialLibrary.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Kismet/KismetMathLibrary.h"
 
 void USlashAnimInstance::NativeInitializeAnimation()
 {
@@ -26,10 +25,21 @@ void USlashAnimInstance::NativeUpdateAnimation(float DeltaTime)
 
 	if (SlashCharacterMovement)
 	{
-		GroundSpeed = UKismetMathLibrary::VSizeXY(SlashCharacterMovement->Velocity);
-		IsFalling = SlashCharacterMovement->IsFalling();
-		CharacterState = SlashCharacter->GetCharacterState();
-		ActionState = SlashCharacter->GetActionState();
-		DeathPose = SlashCharacter->GetDeathPose();
+		Snapshot.Velocity = SlashCharacterMovement->Velocity;
+		Snapshot.bIsFalling = SlashCharacterMovement->IsFalling();
+		Snapshot.CharacterState = SlashCharacter->GetCharacterState();
+		Snapshot.ActionState = SlashCharacter->GetActionState();
+		Snapshot.DeathPose = SlashCharacter->GetDeathPose();
 	}
 }
+
+void USlashAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaTime)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
+
+	GroundSpeed = Snapshot.Velocity.Size2D();
+	IsFalling = Snapshot.bIsFalling;
+	CharacterState = Snapshot.CharacterState;
+	ActionState = Snapshot.ActionState;
+	DeathPose = Snapshot.DeathPose;
+}
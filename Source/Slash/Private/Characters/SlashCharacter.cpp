@@ -19,6 +19,14 @@
 #include "Slash/DebugMacros.h"
 #include "Item/Soul.h"
 #include "Item/Treasure.h"
+#include "Combat/CombatSpatialHash.h"
+
+namespace EquipSection
+{
+	/* 장착 몽타주 섹션 (인덱스 = 섹션 캐시 인덱스) */
+	enum : int32 { Equip, Unequip };
+	static const FName Names[] = { TEXT("Equip"), TEXT("Unequip") };
+}
 
 ASlashCharacter::ASlashCharacter()
 {
@@ -31,6 +39,8 @@ ASlashCharacter::ASlashCharacter()
 	GetMesh()->SetGenerateOverlapEvents(true);
 	
 	Attribute = CreateDefaultSubobject<UAttributeComponent>(TEXT("Attributes"));
+	/* 스태미나 회복은 UAttributeStoreSubsystem 이 모든 전투원을 모아 일괄 처리 */
+	Attribute->SetRegenerateStamina(true);
 	
 	/* 스프링암 컴포넌트 생성 */
 	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
@@ -57,7 +67,13 @@ ASlashCharacter::ASlashCharacter()
 void ASlashCharacter::BeginPlay()
 {
 	Super::BeginPlay();
-	Tags.Add(FName("EngageableTarget"));
+	SetCombatantFlags(ECombatantFlags::ECF_EngageableTarget, true);
+	EquipSectionCache.Build(EquipMontage, EquipSection::Names, this);
+
+	if (UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->RegisterActor(this, ECombatActorType::ECAT_Player);
+	}
 	
 	// 컨트롤러가 플레이어 컨트롤러인지 확인
 	if (APlayerController* PlayerController = Cast<APlayerController>(GetController()))
@@ -75,17 +91,6 @@ void ASlashCharacter::BeginPlay()
 	InitializeSlashOverlay();
 }
 
-void ASlashCharacter::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (Attribute && SlashOverlay)
-	{
-		Attribute->RegenStamina(DeltaTime);
-		SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
-	}
-}
-
 /* move 함수 */
 void ASlashCharacter::Move(const FInputActionValue& Value)
 {
@@ -166,14 +171,14 @@ void ASlashCharacter::EKeyPressed()
 		if (CanDisarm())
 		{
 			// 무장해제
-			PlayEquipMontage(FName("Unequip"));
+			PlayEquipMontage(EquipSection::Unequip);
 			CharacterState = ECharacterState::ECS_Unequipped;
 			ActionState = EActionState::EAS_EquippingWeapon;
 		}
 		else if (CanArm())
 		{
 			// 무기장착
-			PlayEquipMontage(FName("Equip"));
+			PlayEquipMontage(EquipSection::Equip);
 			CharacterState = ECharacterState::ECS_EquippedOneHandedWeapon;
 			ActionState = EActionState::EAS_EquippingWeapon;
 		}
@@ -186,10 +191,9 @@ void ASlashCharacter::Dodge()
 	PlayDodgeMontage();
 	ActionState = EActionState::EAS_Dodge;
 
-	if (Attribute && SlashOverlay)
+	if (Attribute)
 	{
 		Attribute->UseStamina(Attribute->GetDodgeConst());
-		SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
 	}
 }
 
@@ -200,10 +204,9 @@ void ASlashCharacter::Attack()
 	if (CanAttack())
 	{
 		PlayAttackMontage();
-		if (Attribute && SlashOverlay)
+		if (Attribute)
 		{
 			Attribute->UseStamina(Attribute->GetAttackStamina());
-			SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
 			UE_LOG(LogTemp, Log, TEXT("AttackStamina: %f"), Attribute->GetAttackStamina());
 		}
 		
@@ -227,21 +230,15 @@ void ASlashCharacter::StrongAttack()
 		ActionState = EActionState::EAS_Attacking;
 	}
 
-	if (Attribute && SlashOverlay)
+	if (Attribute)
 	{
 		Attribute->UseStamina(Attribute->GetAttackStamina());
-		SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
 	}
 }
 
-void ASlashCharacter::PlayEquipMontage(const FName& SectionName)
+void ASlashCharacter::PlayEquipMontage(int32 SectionIndex)
 {
-	UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance();
-	if (AnimInstance && EquipMontage)
-	{
-		AnimInstance->Montage_Play(EquipMontage);
-		AnimInstance->Montage_JumpToSection(SectionName, EquipMontage);
-	}
+	EquipSectionCache.Play(GetMesh()->GetAnimInstance(), SectionIndex);
 }
 
 void ASlashCharacter::Die()
@@ -337,7 +334,6 @@ void ASlashCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComp
 float ASlashCharacter::TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser)
 {
 	HandleDamage(DamageAmount);
-	SetHUDHealth();
 	return DamageAmount;
 }
 
@@ -361,33 +357,15 @@ void ASlashCharacter::InitializeSlashOverlay()
 		if (SlashHUD)
 		{
 			SlashOverlay = SlashHUD->GetSlashOverlay();
-			if (SlashOverlay && Attribute)
+			if (SlashOverlay)
 			{
-				SlashOverlay->SetHealthBarPercent(Attribute->GetHealthPercent());
-				// SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
-				SlashOverlay->SetGold(0);
-				SlashOverlay->SetSouls(0);
+				/* 이후 체력/스태미나/골드/영혼 변경은 속성 컴포넌트 이벤트로 오버레이에 전달됨 */
+				SlashOverlay->BindAttributes(Attribute);
 			}
 		}
 	}
 }
 
-void ASlashCharacter::SetHUDHealth()
-{
-	if (SlashOverlay && Attribute)
-	{
-		SlashOverlay->SetHealthBarPercent(Attribute->GetHealthPercent());
-	}
-}
-
-// void ASlashCharacter::SetHUDStamina()
-// {
-// 	if (SlashOverlay && Attribute)
-// 	{
-// 		SlashOverlay->SetStaminaBarPercent(Attribute->GetStaminaPercent());
-// 	}
-// }
-
 bool ASlashCharacter::IsUnoccupied()
 {
 	return ActionState == EActionState::EAS_Unoccupied;
@@ -400,29 +378,26 @@ void ASlashCharacter::SetOverlappingItem(class AItem* Item)
 
 void ASlashCharacter::AddSoul(ASoul* Soul)
 {
-	if (Attribute && SlashOverlay)
+	if (Attribute)
 	{
 		Attribute->AddSouls(Soul->GetSouls());
-		SlashOverlay->SetSouls(Attribute->GetSouls());
 	}
 	DEBUG_LOG(TEXT("ASlashCharacter::AddSoul"));
 }
 
 void ASlashCharacter::AddGold(ATreasure* ATreasure)
 {
-	if (Attribute && SlashOverlay)
+	if (Attribute)
 	{
 		Attribute->AddGold(ATreasure->GetGold());
-		SlashOverlay->SetGold(Attribute->GetGold());
 	}
 }
 
 void ASlashCharacter::AddHealth(AHealPotion* AHealPotion)
 {
-	if (Attribute && SlashOverlay)
+	if (Attribute)
 	{
 		Attribute->AddHealPotion(AHealPotion->GetHealAmount());
-		SlashOverlay->SetHealthBarPercent(Attribute->GetHealthPercent());
 	}
 }
 
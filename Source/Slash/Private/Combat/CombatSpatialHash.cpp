@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Combat/CombatSpatialHash.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Spatial Hash Query"), STAT_SpatialHashQuery, STATGROUP_SlashCombat);
+DECLARE_CYCLE_STAT(TEXT("Spatial Hash Update"), STAT_SpatialHashUpdate, STATGROUP_SlashCombat);
+
+void UCombatSpatialHash::Deinitialize()
+{
+	for (const FEntry& Entry : Entries)
+	{
+		if (Entry.Actor && Entry.Actor->GetRootComponent())
+		{
+			Entry.Actor->GetRootComponent()->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+		}
+	}
+	Entries.Empty();
+	FreeEntries.Empty();
+	Cells.Empty();
+	ActorToEntry.Empty();
+	Super::Deinitialize();
+}
+
+bool UCombatSpatialHash::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatSpatialHash::RegisterActor(AActor* Actor, ECombatActorType Type)
+{
+	if (Actor == nullptr || ActorToEntry.Contains(Actor)) return;
+
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Actor = Actor;
+	Entry.Type = Type;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Cell = ToCell(Entry.Location);
+	AddToCell(EntryIndex);
+
+	if (USceneComponent* Root = Actor->GetRootComponent())
+	{
+		Entry.TransformUpdatedHandle = Root->TransformUpdated.AddUObject(this, &UCombatSpatialHash::OnRootTransformUpdated, EntryIndex);
+	}
+	ActorToEntry.Add(Actor, EntryIndex);
+}
+
+void UCombatSpatialHash::UnregisterActor(AActor* Actor)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!ActorToEntry.RemoveAndCopyValue(Actor, EntryIndex)) return;
+
+	FEntry& Entry = Entries[EntryIndex];
+	if (USceneComponent* Root = Actor->GetRootComponent())
+	{
+		Root->TransformUpdated.Remove(Entry.TransformUpdatedHandle);
+	}
+	RemoveFromCell(EntryIndex);
+	Entry = FEntry();
+	FreeEntries.Add(EntryIndex);
+}
+
+/**
+ * 반경 안의 액터를 찾습니다.
+ * 반경을 덮는 칸들만 훑으며, 거리 비교는 제곱근 없이 제곱 거리로 합니다.
+ */
+void UCombatSpatialHash::QueryRadius(const FVector& Center, double Radius, ECombatActorType TypeMask, TArray<AActor*>& OutActors) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialHashQuery);
+
+	const double RadiusSquared = Radius * Radius;
+	const FIntPoint MinCell = ToCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = ToCell(Center + FVector(Radius));
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* CellEntries = Cells.Find(FIntPoint(X, Y));
+			if (CellEntries == nullptr) continue;
+
+			for (const int32 EntryIndex : *CellEntries)
+			{
+				const FEntry& Entry = Entries[EntryIndex];
+				if (!EnumHasAnyFlags(Entry.Type, TypeMask)) continue;
+				if (FVector::DistSquared(Entry.Location, Center) <= RadiusSquared)
+				{
+					OutActors.Add(Entry.Actor);
+				}
+			}
+		}
+	}
+}
+
+void UCombatSpatialHash::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 EntryIndex)
+{
+	if (UpdatedComponent)
+	{
+		UpdateEntryLocation(EntryIndex, UpdatedComponent->GetComponentLocation());
+	}
+}
+
+/**
+ * 위치를 갱신하고, 칸이 바뀐 경우에만 칸 목록을 옮깁니다.
+ */
+void UCombatSpatialHash::UpdateEntryLocation(int32 EntryIndex, const FVector& NewLocation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialHashUpdate);
+
+	if (!Entries.IsValidIndex(EntryIndex)) return;
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Location = NewLocation;
+
+	const FIntPoint NewCell = ToCell(NewLocation);
+	if (NewCell != Entry.Cell)
+	{
+		RemoveFromCell(EntryIndex);
+		Entry.Cell = NewCell;
+		AddToCell(EntryIndex);
+	}
+}
+
+void UCombatSpatialHash::AddToCell(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>& CellEntries = Cells.FindOrAdd(Entry.Cell);
+	Entry.IndexInCell = CellEntries.Add(EntryIndex);
+}
+
+void UCombatSpatialHash::RemoveFromCell(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	TArray<int32>* CellEntries = Cells.Find(Entry.Cell);
+	if (CellEntries == nullptr || !CellEntries->IsValidIndex(Entry.IndexInCell)) return;
+
+	// 마지막 원소를 빈 자리로 옮기고 옮겨진 원소의 IndexInCell 을 고침
+	CellEntries->RemoveAtSwap(Entry.IndexInCell, 1, EAllowShrinking::No);
+	if (CellEntries->IsValidIndex(Entry.IndexInCell))
+	{
+		Entries[(*CellEntries)[Entry.IndexInCell]].IndexInCell = Entry.IndexInCell;
+	}
+	Entry.IndexInCell = INDEX_NONE;
+}
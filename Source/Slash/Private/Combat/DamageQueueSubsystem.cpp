@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Combat/DamageQueueSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/DamageType.h"
+#include "Interface/HitInterface.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Damage Queue Resolve"), STAT_DamageQueueResolve, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damage Events"), STAT_DamageEvents, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Damaged Targets"), STAT_DamagedTargets, STATGROUP_SlashCombat);
+
+void FDamageQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target)
+	{
+		Target->ResolveQueuedDamage();
+	}
+}
+
+FString FDamageQueueTickFunction::DiagnosticMessage()
+{
+	return TEXT("UDamageQueueSubsystem::ResolveQueuedDamage");
+}
+
+void UDamageQueueSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.Target = this;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = true;
+	TickFunction.TickGroup = TG_PrePhysics;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UDamageQueueSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	TickFunction.Target = nullptr;
+	QueuedDamage.Empty();
+	Super::Deinitialize();
+}
+
+bool UDamageQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDamageQueueSubsystem::QueueDamage(const FQueuedDamage& Damage)
+{
+	QueuedDamage.Add(Damage);
+}
+
+/**
+ * 1. 이벤트를 대상별로 묶어 피해량 합산 (대상 순서 = 처음 맞은 순서)
+ * 2. 대상마다 ApplyDamage 한 번 → GetHit 한 번 (기존 무기 처리와 같은 순서)
+ * 대상이나 가해자가 그 사이 사라졌으면 해당 이벤트는 버립니다.
+ */
+void UDamageQueueSubsystem::ResolveQueuedDamage()
+{
+	SCOPE_CYCLE_COUNTER(STAT_DamageQueueResolve);
+	SET_DWORD_STAT(STAT_DamageEvents, QueuedDamage.Num());
+	if (QueuedDamage.IsEmpty())
+	{
+		SET_DWORD_STAT(STAT_DamagedTargets, 0);
+		return;
+	}
+
+	Swap(ResolvingDamage, QueuedDamage);
+	TargetDamage.Reset();
+	TargetToIndex.Reset();
+
+	for (int32 EventIndex = 0; EventIndex < ResolvingDamage.Num(); ++EventIndex)
+	{
+		AActor* Target = ResolvingDamage[EventIndex].Target.Get();
+		if (Target == nullptr) continue;
+
+		if (const int32* Existing = TargetToIndex.Find(Target))
+		{
+			TargetDamage[*Existing].TotalAmount += ResolvingDamage[EventIndex].Amount;
+			continue;
+		}
+
+		FTargetDamage& NewTarget = TargetDamage.AddDefaulted_GetRef();
+		NewTarget.FirstEventIndex = EventIndex;
+		NewTarget.TotalAmount = ResolvingDamage[EventIndex].Amount;
+		TargetToIndex.Add(Target, TargetDamage.Num() - 1);
+	}
+
+	for (const FTargetDamage& Resolved : TargetDamage)
+	{
+		const FQueuedDamage& First = ResolvingDamage[Resolved.FirstEventIndex];
+		AActor* Target = First.Target.Get();
+		if (Target == nullptr) continue;
+
+		UGameplayStatics::ApplyDamage(Target, Resolved.TotalAmount, First.Instigator.Get(), First.Causer.Get(), UDamageType::StaticClass());
+
+		if (IsValid(Target) && Target->Implements<UHitInterface>())
+		{
+			IHitInterface::Execute_GetHit(Target, First.ImpactPoint, First.Hitter.Get());
+		}
+	}
+
+	SET_DWORD_STAT(STAT_DamagedTargets, TargetDamage.Num());
+	ResolvingDamage.Reset();
+}
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Combat/ImpactEffectSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
+#include "Particles/ParticleSystem.h"
+#include "Sound/SoundBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Impact Effects Flush"), STAT_ImpactEffectsFlush, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Requests"), STAT_ImpactRequests, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Merged"), STAT_ImpactMerged, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Culled By Budget"), STAT_ImpactCulled, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Effects Spawned"), STAT_ImpactEffectsSpawned, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Batched Records"), STAT_ImpactBatchedRecords, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Impact Sounds Played"), STAT_ImpactSoundsPlayed, STATGROUP_SlashCombat);
+
+/**
+ * 기본 일괄 피격 이펙트를 미리 로드해 첫 피격 때 동기 로드로 멈추지 않게 합니다.
+ */
+void UImpactEffectSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!DefaultHitImpactSystem.IsNull())
+	{
+		LoadedDefaultHitImpactSystem = DefaultHitImpactSystem.LoadSynchronous();
+		if (LoadedDefaultHitImpactSystem == nullptr)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("DefaultHitImpactSystem %s failed to load, characters without HitImpactSystem use HitParticles"), *DefaultHitImpactSystem.ToString());
+		}
+	}
+}
+
+void UImpactEffectSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectPtr<UNiagaraSystem>, TObjectPtr<UNiagaraComponent>>& Pair : BatchedComponents)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->DestroyComponent();
+		}
+	}
+	BatchedComponents.Empty();
+	BatchedSystemsWithRecords.Empty();
+	EffectRequests.Empty();
+	SoundRequests.Empty();
+	BatchedRequests.Empty();
+	LoadedDefaultHitImpactSystem = nullptr;
+	Super::Deinitialize();
+}
+
+bool UImpactEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 이번 프레임에 모인 요청을 예산 안에서 재생하고 비웁니다.
+ * 카메라가 없으면(플레이어 컨트롤러 없음) 거리 우선순위 없이 들어온 순서대로 예산을 적용합니다.
+ */
+void UImpactEffectSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ImpactEffectsFlush);
+
+	FVector CameraLocation = FVector::ZeroVector;
+	bool bHasCamera = false;
+	if (const APlayerController* Controller = GetWorld()->GetFirstPlayerController())
+	{
+		FRotator CameraRotation;
+		Controller->GetPlayerViewPoint(CameraLocation, CameraRotation);
+		bHasCamera = true;
+	}
+
+	int32 NumCulled = 0;
+	if (bHasCamera)
+	{
+		NumCulled += ApplyBudget(EffectRequests, MaxEffectsPerFrame, CameraLocation);
+		NumCulled += ApplyBudget(SoundRequests, MaxSoundsPerFrame, CameraLocation);
+		NumCulled += ApplyBudget(BatchedRequests, MaxBatchedImpactsPerFrame, CameraLocation);
+	}
+	else
+	{
+		const int32 NumEffectsCulled = FMath::Max(EffectRequests.Num() - FMath::Max(MaxEffectsPerFrame, 0), 0);
+		const int32 NumSoundsCulled = FMath::Max(SoundRequests.Num() - FMath::Max(MaxSoundsPerFrame, 0), 0);
+		const int32 NumBatchedCulled = FMath::Max(BatchedRequests.Num() - FMath::Max(MaxBatchedImpactsPerFrame, 0), 0);
+		EffectRequests.SetNum(EffectRequests.Num() - NumEffectsCulled, EAllowShrinking::No);
+		SoundRequests.SetNum(SoundRequests.Num() - NumSoundsCulled, EAllowShrinking::No);
+		BatchedRequests.SetNum(BatchedRequests.Num() - NumBatchedCulled, EAllowShrinking::No);
+		NumCulled = NumEffectsCulled + NumSoundsCulled + NumBatchedCulled;
+	}
+
+	SET_DWORD_STAT(STAT_ImpactRequests, NumRequested);
+	SET_DWORD_STAT(STAT_ImpactMerged, NumMerged);
+	SET_DWORD_STAT(STAT_ImpactCulled, NumCulled);
+	SET_DWORD_STAT(STAT_ImpactEffectsSpawned, EffectRequests.Num());
+	SET_DWORD_STAT(STAT_ImpactBatchedRecords, BatchedRequests.Num());
+	SET_DWORD_STAT(STAT_ImpactSoundsPlayed, SoundRequests.Num());
+
+	PlayEffects();
+	PlaySounds();
+	FlushBatchedImpacts();
+
+	EffectRequests.Reset();
+	SoundRequests.Reset();
+	BatchedRequests.Reset();
+	NumRequested = 0;
+	NumMerged = 0;
+}
+
+TStatId UImpactEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UImpactEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UImpactEffectSubsystem::QueueSound(USoundBase* Sound, const FVector& Location)
+{
+	if (Sound == nullptr) return;
+	AddRequest(SoundRequests, Sound, Location);
+}
+
+void UImpactEffectSubsystem::QueueParticles(UParticleSystem* Particles, const FVector& Location)
+{
+	if (Particles == nullptr) return;
+	AddRequest(EffectRequests, Particles, Location);
+}
+
+void UImpactEffectSubsystem::QueueNiagara(UNiagaraSystem* System, const FVector& Location)
+{
+	if (System == nullptr) return;
+	AddRequest(EffectRequests, System, Location);
+}
+
+void UImpactEffectSubsystem::QueueBatchedNiagara(UNiagaraSystem* System, const FVector& Location)
+{
+	if (System == nullptr) return;
+	AddRequest(BatchedRequests, System, Location);
+}
+
+void UImpactEffectSubsystem::AddRequest(TArray<FImpactRequest>& Requests, UObject* Asset, const FVector& Location)
+{
+	++NumRequested;
+
+	const float MergeRadiusSquared = FMath::Square(MergeRadius);
+	for (const FImpactRequest& Request : Requests)
+	{
+		if (Request.Asset == Asset && FVector::DistSquared(Request.Location, Location) <= MergeRadiusSquared)
+		{
+			++NumMerged;
+			return;
+		}
+	}
+
+	FImpactRequest& NewRequest = Requests.AddDefaulted_GetRef();
+	NewRequest.Asset = Asset;
+	NewRequest.Location = Location;
+}
+
+int32 UImpactEffectSubsystem::ApplyBudget(TArray<FImpactRequest>& Requests, int32 Budget, const FVector& CameraLocation) const
+{
+	const int32 NumCulled = FMath::Max(Requests.Num() - FMath::Max(Budget, 0), 0);
+	if (NumCulled == 0) return 0;
+
+	for (FImpactRequest& Request : Requests)
+	{
+		Request.DistanceSquared = FVector::DistSquared(Request.Location, CameraLocation);
+	}
+	Requests.Sort([](const FImpactRequest& A, const FImpactRequest& B) { return A.DistanceSquared < B.DistanceSquared; });
+	Requests.SetNum(Requests.Num() - NumCulled, EAllowShrinking::No);
+	return NumCulled;
+}
+
+void UImpactEffectSubsystem::PlayEffects()
+{
+	UWorld* World = GetWorld();
+	for (const FImpactRequest& Request : EffectRequests)
+	{
+		if (UNiagaraSystem* System = Cast<UNiagaraSystem>(Request.Asset))
+		{
+			UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, System, Request.Location, FRotator::ZeroRotator, FVector(1.f), true, true, ENCPoolMethod::AutoRelease);
+		}
+		else if (UParticleSystem* Particles = Cast<UParticleSystem>(Request.Asset))
+		{
+			UGameplayStatics::SpawnEmitterAtLocation(World, Particles, FTransform(Request.Location), true, EPSCPoolMethod::AutoRelease);
+		}
+	}
+}
+
+void UImpactEffectSubsystem::PlaySounds()
+{
+	for (const FImpactRequest& Request : SoundRequests)
+	{
+		UGameplayStatics::PlaySoundAtLocation(this, CastChecked<USoundBase>(Request.Asset), Request.Location);
+	}
+}
+
+/**
+ * 1. 예산 안에 남은 기록을 시스템별 위치 배열로 모음
+ * 2. 시스템마다 상주 컴포넌트의 위치 배열을 한 번에 교체
+ * 3. 지난 프레임에 기록이 있었는데 이번에 없는 시스템은 빈 배열로 바꿔 같은 위치에 다시 스폰되지 않게 함
+ */
+void UImpactEffectSubsystem::FlushBatchedImpacts()
+{
+	if (BatchedRequests.IsEmpty() && BatchedSystemsWithRecords.IsEmpty()) return;
+
+	for (TPair<UNiagaraSystem*, TArray<FVector>>& Pair : BatchedPositions)
+	{
+		Pair.Value.Reset();
+	}
+	for (const FImpactRequest& Request : BatchedRequests)
+	{
+		BatchedPositions.FindOrAdd(CastChecked<UNiagaraSystem>(Request.Asset)).Add(Request.Location);
+	}
+
+	for (TPair<UNiagaraSystem*, TArray<FVector>>& Pair : BatchedPositions)
+	{
+		const bool bHasRecords = !Pair.Value.IsEmpty();
+		if (!bHasRecords && !BatchedSystemsWithRecords.Contains(Pair.Key)) continue;
+
+		if (UNiagaraComponent* Component = FindOrCreateBatchedComponent(Pair.Key))
+		{
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(Component, BatchedPositionsParameter, Pair.Value);
+		}
+
+		if (bHasRecords)
+		{
+			BatchedSystemsWithRecords.Add(Pair.Key);
+		}
+		else
+		{
+			BatchedSystemsWithRecords.Remove(Pair.Key);
+		}
+	}
+}
+
+UNiagaraComponent* UImpactEffectSubsystem::FindOrCreateBatchedComponent(UNiagaraSystem* System)
+{
+	if (TObjectPtr<UNiagaraComponent>* Existing = BatchedComponents.Find(System))
+	{
+		if (IsValid(*Existing)) return *Existing;
+	}
+
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), System, FVector::ZeroVector, FRotator::ZeroRotator, FVector(1.f), false, true, ENCPoolMethod::None);
+	BatchedComponents.Add(System, Component);
+	return Component;
+}
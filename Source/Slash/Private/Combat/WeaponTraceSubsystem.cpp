@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Combat/WeaponTraceSubsystem.h"
+#include "Item/Weapons/Weapon.h"
+#include "Engine/World.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Weapon Trace Submit"), STAT_WeaponTraceSubmit, STATGROUP_SlashCombat);
+DECLARE_CYCLE_STAT(TEXT("Weapon Trace Resolve"), STAT_WeaponTraceResolve, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weapon Traces In Flight"), STAT_WeaponTracesInFlight, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Weapon Swings"), STAT_ActiveWeaponSwings, STATGROUP_SlashCombat);
+
+void UWeaponTraceSubsystem::Deinitialize()
+{
+	QueuedWeapons.Empty();
+	InFlightTraces.Empty();
+	ActiveSwings.Empty();
+	Super::Deinitialize();
+}
+
+bool UWeaponTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWeaponTraceSubsystem::Tick(float DeltaTime)
+{
+	ResolveInFlightTraces();
+	SubmitQueuedTraces();
+	SubmitSweptTraces();
+	SET_DWORD_STAT(STAT_WeaponTracesInFlight, InFlightTraces.Num());
+	SET_DWORD_STAT(STAT_ActiveWeaponSwings, ActiveSwings.Num());
+}
+
+TStatId UWeaponTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWeaponTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UWeaponTraceSubsystem::QueueBoxTrace(AWeapon* Weapon)
+{
+	if (Weapon)
+	{
+		QueuedWeapons.AddUnique(Weapon);
+	}
+}
+
+void UWeaponTraceSubsystem::BeginSwing(AWeapon* Weapon)
+{
+	if (Weapon == nullptr) return;
+
+	FActiveSwing* Swing = ActiveSwings.FindByPredicate([Weapon](const FActiveSwing& Active) { return Active.Weapon == Weapon; });
+	if (Swing == nullptr)
+	{
+		Swing = &ActiveSwings.AddDefaulted_GetRef();
+		Swing->Weapon = Weapon;
+	}
+	Weapon->GetBladeTransform(Swing->PreviousStart, Swing->PreviousEnd, Swing->PreviousRotation);
+}
+
+void UWeaponTraceSubsystem::EndSwing(AWeapon* Weapon)
+{
+	ActiveSwings.RemoveAllSwap([Weapon](const FActiveSwing& Active) { return Active.Weapon == Weapon; });
+}
+
+/**
+ * 지난 프레임에 제출한 트레이스 결과를 받아 무기에 전달합니다.
+ * 무기가 그 사이 사라졌거나 새 휘두르기를 시작했다면 결과는 버립니다.
+ */
+void UWeaponTraceSubsystem::ResolveInFlightTraces()
+{
+	SCOPE_CYCLE_COUNTER(STAT_WeaponTraceResolve);
+
+	UWorld* World = GetWorld();
+	FTraceDatum Datum;
+	for (const FInFlightTrace& InFlight : InFlightTraces)
+	{
+		AWeapon* Weapon = InFlight.Weapon.Get();
+		if (Weapon == nullptr || Weapon->GetSwingId() != InFlight.SwingId) continue;
+		if (!World->QueryTraceData(InFlight.Handle, Datum)) continue;
+
+		for (const FHitResult& Hit : Datum.OutHits)
+		{
+			if (Hit.bBlockingHit)
+			{
+				Weapon->ResolveBoxHit(Hit);
+			}
+		}
+	}
+	InFlightTraces.Reset();
+}
+
+void UWeaponTraceSubsystem::SubmitQueuedTraces()
+{
+	SCOPE_CYCLE_COUNTER(STAT_WeaponTraceSubmit);
+
+	UWorld* World = GetWorld();
+	for (const TWeakObjectPtr<AWeapon>& WeakWeapon : QueuedWeapons)
+	{
+		AWeapon* Weapon = WeakWeapon.Get();
+		if (Weapon == nullptr) continue;
+
+		FInFlightTrace& InFlight = InFlightTraces.AddDefaulted_GetRef();
+		InFlight.Weapon = Weapon;
+		InFlight.SwingId = Weapon->GetSwingId();
+		InFlight.Handle = Weapon->SubmitBoxTrace(World);
+	}
+	QueuedWeapons.Reset();
+}
+
+/**
+ * 휘두르는 중인 무기마다 지난 프레임과 이번 프레임의 칼날 위치 사이를 구간으로 나눠 스윕합니다.
+ * 구간 수 = 칼날 회전각 / MaxDegreesPerSweep (1 ~ MaxSweepSubsteps)
+ * 첫 구간은 지난 프레임(또는 BeginSwing) 칼날 위치에서 시작하므로 휘두르기 첫 자세도 빠지지 않습니다.
+ */
+void UWeaponTraceSubsystem::SubmitSweptTraces()
+{
+	SCOPE_CYCLE_COUNTER(STAT_WeaponTraceSubmit);
+
+	UWorld* World = GetWorld();
+	for (int32 Index = ActiveSwings.Num() - 1; Index >= 0; --Index)
+	{
+		FActiveSwing& Swing = ActiveSwings[Index];
+		AWeapon* Weapon = Swing.Weapon.Get();
+		if (Weapon == nullptr)
+		{
+			ActiveSwings.RemoveAtSwap(Index);
+			continue;
+		}
+
+		FVector CurrentStart;
+		FVector CurrentEnd;
+		FQuat CurrentRotation;
+		Weapon->GetBladeTransform(CurrentStart, CurrentEnd, CurrentRotation);
+
+		const float SweptDegrees = FMath::RadiansToDegrees(Swing.PreviousRotation.AngularDistance(CurrentRotation));
+		const int32 NumSubsteps = FMath::Clamp(FMath::CeilToInt32(SweptDegrees / Weapon->GetMaxDegreesPerSweep()), 1, Weapon->GetMaxSweepSubsteps());
+
+		FVector FromStart = Swing.PreviousStart;
+		FVector FromEnd = Swing.PreviousEnd;
+		for (int32 Substep = 1; Substep <= NumSubsteps; ++Substep)
+		{
+			const float Alpha = static_cast<float>(Substep) / NumSubsteps;
+			const FVector ToStart = FMath::Lerp(Swing.PreviousStart, CurrentStart, Alpha);
+			const FVector ToEnd = FMath::Lerp(Swing.PreviousEnd, CurrentEnd, Alpha);
+
+			FInFlightTrace& InFlight = InFlightTraces.AddDefaulted_GetRef();
+			InFlight.Weapon = Weapon;
+			InFlight.SwingId = Weapon->GetSwingId();
+			InFlight.Handle = Weapon->SubmitBladeSweep(World, FromStart, FromEnd, ToStart, ToEnd);
+
+			FromStart = ToStart;
+			FromEnd = ToEnd;
+		}
+
+		Swing.PreviousStart = CurrentStart;
+		Swing.PreviousEnd = CurrentEnd;
+		Swing.PreviousRotation = CurrentRotation;
+	}
+}
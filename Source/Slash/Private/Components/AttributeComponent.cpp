@@ -2,68 +2,157 @@
 
 
 #include "Components/AttributeComponent.h"
+#include "Components/AttributeStoreSubsystem.h"
 
 UAttributeComponent::UAttributeComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
-	
+
 }
 
 void UAttributeComponent::BeginPlay()
 {
 	Super::BeginPlay();
-}
 
-void UAttributeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Store = GetWorld()->GetSubsystem<UAttributeStoreSubsystem>();
+	if (Store)
+	{
+		Store->RegisterAttributes(this);
+	}
 }
 
-void UAttributeComponent::RegenStamina(float DeltaTime)
+void UAttributeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Stamina = FMath::Clamp(Stamina + StaminaRegenRate * DeltaTime, 0.f, MaxStamina);
+	if (Store)
+	{
+		Store->UnregisterAttributes(this);
+		Store = nullptr;
+	}
+	Super::EndPlay(EndPlayReason);
 }
 
+/**
+ * 저장소에 등록되어 있으면 저장소 값을, 아니면 (BeginPlay 전, EndPlay 후, 저장소가 없는 월드) 컴포넌트의 값을 바꿉니다.
+ */
 void UAttributeComponent::ReceiveDamage(float Damage)
 {
-	Health = FMath::Clamp(Health - Damage, 0.f, MaxHealth);
+	if (HasStoreHandle())
+	{
+		Store->SetHealth(StoreIndex, FMath::Clamp(GetHealth() - Damage, 0.f, Store->GetMaxHealth(StoreIndex)));
+		return;
+	}
+	SetLocalHealth(FMath::Clamp(Health - Damage, 0.f, MaxHealth));
 }
 
 void UAttributeComponent::UseStamina(float StaminaConst)
 {
-	Stamina = FMath::Clamp(Stamina - StaminaConst, 0.f, MaxStamina);
+	if (HasStoreHandle())
+	{
+		Store->SetStamina(StoreIndex, FMath::Clamp(GetStamina() - StaminaConst, 0.f, Store->GetMaxStamina(StoreIndex)));
+		return;
+	}
+	SetLocalStamina(FMath::Clamp(Stamina - StaminaConst, 0.f, MaxStamina));
 }
 
 float UAttributeComponent::GetHealthPercent()
 {
-	return Health / MaxHealth;
+	return GetHealth() / (HasStoreHandle() ? Store->GetMaxHealth(StoreIndex) : MaxHealth);
 }
 
 bool UAttributeComponent::IsAlive()
 {
-	return Health > 0.f;
+	return GetHealth() > 0.f;
 }
 
 float UAttributeComponent::GetStaminaPercent()
 {
-	return Stamina / MaxStamina;
+	return GetStamina() / (HasStoreHandle() ? Store->GetMaxStamina(StoreIndex) : MaxStamina);
 }
 
 void UAttributeComponent::AddGold(int32 NumberOfGold)
 {
+	if (HasStoreHandle())
+	{
+		Store->AddGold(StoreIndex, NumberOfGold);
+		return;
+	}
+	if (NumberOfGold == 0) return;
 	Gold += NumberOfGold;
+	OnAttributeChanged.Broadcast(this, EAttributeType::EAT_Gold);
 }
 
 void UAttributeComponent::AddSouls(int32 NumberOfSouls)
 {
+	if (HasStoreHandle())
+	{
+		Store->AddSouls(StoreIndex, NumberOfSouls);
+		return;
+	}
+	if (NumberOfSouls == 0) return;
 	Souls += NumberOfSouls;
+	OnAttributeChanged.Broadcast(this, EAttributeType::EAT_Souls);
 }
 
 void UAttributeComponent::AddHealPotion(int32 NumberOfHealPotion)
 {
-	if (NumberOfHealPotion < MaxHealth)
+	const float CurrentMaxHealth = HasStoreHandle() ? Store->GetMaxHealth(StoreIndex) : MaxHealth;
+	if (NumberOfHealPotion < CurrentMaxHealth)
 	{
-		Health += FMath::Clamp(Health + NumberOfHealPotion, 0.f, MaxHealth);
+		const float CurrentHealth = GetHealth();
+		const float NewHealth = CurrentHealth + FMath::Clamp(CurrentHealth + NumberOfHealPotion, 0.f, CurrentMaxHealth);
+		if (HasStoreHandle())
+		{
+			Store->SetHealth(StoreIndex, NewHealth);
+		}
+		else
+		{
+			SetLocalHealth(NewHealth);
+		}
 	}
 }
 
+void UAttributeComponent::ResetAttributes()
+{
+	if (HasStoreHandle())
+	{
+		Store->SetHealth(StoreIndex, Store->GetMaxHealth(StoreIndex));
+		Store->SetStamina(StoreIndex, Store->GetMaxStamina(StoreIndex));
+		return;
+	}
+	SetLocalHealth(MaxHealth);
+	SetLocalStamina(MaxStamina);
+}
+
+void UAttributeComponent::SetLocalHealth(float NewHealth)
+{
+	if (Health == NewHealth) return;
+	Health = NewHealth;
+	OnAttributeChanged.Broadcast(this, EAttributeType::EAT_Health);
+}
+
+void UAttributeComponent::SetLocalStamina(float NewStamina)
+{
+	if (Stamina == NewStamina) return;
+	Stamina = NewStamina;
+	OnAttributeChanged.Broadcast(this, EAttributeType::EAT_Stamina);
+}
+
+int32 UAttributeComponent::GetGold() const
+{
+	return HasStoreHandle() ? Store->GetGold(StoreIndex) : Gold;
+}
+
+int32 UAttributeComponent::GetSouls() const
+{
+	return HasStoreHandle() ? Store->GetSouls(StoreIndex) : Souls;
+}
+
+float UAttributeComponent::GetStamina() const
+{
+	return HasStoreHandle() ? Store->GetStamina(StoreIndex) : Stamina;
+}
+
+float UAttributeComponent::GetHealth() const
+{
+	return HasStoreHandle() ? Store->GetHealth(StoreIndex) : Health;
+}
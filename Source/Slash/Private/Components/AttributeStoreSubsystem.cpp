@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/AttributeStoreSubsystem.h"
+#include "Components/AttributeComponent.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Attribute Store Update"), STAT_AttributeStoreUpdate, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Combatants"), STAT_Combatants, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Living Combatants"), STAT_LivingCombatants, STATGROUP_SlashCombat);
+
+void UAttributeStoreSubsystem::Deinitialize()
+{
+	for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+	{
+		if (Components[Index])
+		{
+			UnregisterAttributes(Components[Index]);
+		}
+	}
+	Super::Deinitialize();
+}
+
+bool UAttributeStoreSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 1. 스태미나 회복: 모든 전투원을 분기 없이 한 번에 계산 (회복하지 않는 전투원은 회복량 0)
+ *    바뀐 인덱스는 전투원 수만큼 잡아 둔 배열에 조건 없이 쓰고, 바뀐 경우에만 개수를 1 늘림
+ * 2. 바뀐 전투원에게만 변경 이벤트 호출
+ * 3. 생존 전투원 집계
+ */
+void UAttributeStoreSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AttributeStoreUpdate);
+
+	const int32 NumCombatants = Components.Num();
+	float* RESTRICT StaminaData = Stamina.GetData();
+	const float* RESTRICT MaxStaminaData = MaxStamina.GetData();
+	const float* RESTRICT RegenData = StaminaRegenRate.GetData();
+
+	ChangedStamina.SetNumUninitialized(NumCombatants, EAllowShrinking::No);
+	int32* RESTRICT ChangedData = ChangedStamina.GetData();
+	int32 NumChanged = 0;
+	for (int32 Index = 0; Index < NumCombatants; ++Index)
+	{
+		const float OldStamina = StaminaData[Index];
+		const float NewStamina = FMath::Clamp(OldStamina + RegenData[Index] * DeltaTime, 0.f, MaxStaminaData[Index]);
+		StaminaData[Index] = NewStamina;
+		ChangedData[NumChanged] = Index;
+		NumChanged += NewStamina != OldStamina;
+	}
+
+	for (int32 Changed = 0; Changed < NumChanged; ++Changed)
+	{
+		const int32 Index = ChangedData[Changed];
+		Components[Index]->OnAttributeChanged.Broadcast(Components[Index], EAttributeType::EAT_Stamina);
+	}
+
+	int32 NumLiving = 0;
+	const float* RESTRICT HealthData = Health.GetData();
+	for (int32 Index = 0; Index < NumCombatants; ++Index)
+	{
+		NumLiving += HealthData[Index] > 0.f;
+	}
+
+	SET_DWORD_STAT(STAT_Combatants, NumCombatants);
+	SET_DWORD_STAT(STAT_LivingCombatants, NumLiving);
+}
+
+TStatId UAttributeStoreSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAttributeStoreSubsystem, STATGROUP_Tickables);
+}
+
+void UAttributeStoreSubsystem::RegisterAttributes(UAttributeComponent* Component)
+{
+	if (Component == nullptr || Component->StoreIndex != INDEX_NONE) return;
+
+	Component->StoreIndex = Components.Add(Component);
+	Health.Add(Component->Health);
+	MaxHealth.Add(Component->MaxHealth);
+	Stamina.Add(Component->Stamina);
+	MaxStamina.Add(Component->MaxStamina);
+	StaminaRegenRate.Add(Component->bRegenerateStamina ? Component->StaminaRegenRate : 0.f);
+	Gold.Add(Component->Gold);
+	Souls.Add(Component->Souls);
+}
+
+void UAttributeStoreSubsystem::UnregisterAttributes(UAttributeComponent* Component)
+{
+	if (Component == nullptr || !Components.IsValidIndex(Component->StoreIndex) || Components[Component->StoreIndex] != Component) return;
+
+	const int32 Index = Component->StoreIndex;
+	Component->Health = Health[Index];
+	Component->Stamina = Stamina[Index];
+	Component->Gold = Gold[Index];
+	Component->Souls = Souls[Index];
+	Component->StoreIndex = INDEX_NONE;
+
+	Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Health.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MaxHealth.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Stamina.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	MaxStamina.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StaminaRegenRate.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Gold.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Souls.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Components.IsValidIndex(Index))
+	{
+		Components[Index]->StoreIndex = Index;
+	}
+}
+
+void UAttributeStoreSubsystem::SetHealth(int32 Index, float NewHealth)
+{
+	if (Health[Index] == NewHealth) return;
+	Health[Index] = NewHealth;
+	Components[Index]->OnAttributeChanged.Broadcast(Components[Index], EAttributeType::EAT_Health);
+}
+
+void UAttributeStoreSubsystem::SetStamina(int32 Index, float NewStamina)
+{
+	if (Stamina[Index] == NewStamina) return;
+	Stamina[Index] = NewStamina;
+	Components[Index]->OnAttributeChanged.Broadcast(Components[Index], EAttributeType::EAT_Stamina);
+}
+
+void UAttributeStoreSubsystem::AddGold(int32 Index, int32 NumberOfGold)
+{
+	if (NumberOfGold == 0) return;
+	Gold[Index] += NumberOfGold;
+	Components[Index]->OnAttributeChanged.Broadcast(Components[Index], EAttributeType::EAT_Gold);
+}
+
+void UAttributeStoreSubsystem::AddSouls(int32 Index, int32 NumberOfSouls)
+{
+	if (NumberOfSouls == 0) return;
+	Souls[Index] += NumberOfSouls;
+	Components[Index]->OnAttributeChanged.Broadcast(Components[Index], EAttributeType::EAT_Souls);
+}
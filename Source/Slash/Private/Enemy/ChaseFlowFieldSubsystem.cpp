@@ -0,0 +1,322 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/ChaseFlowFieldSubsystem.h"
+#include "Enemy/Enemy.h"
+#include "Combat/CombatSpatialHash.h"
+#include "NavigationSystem.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Flow Field Build"), STAT_FlowFieldBuild, STATGROUP_SlashAI);
+DECLARE_CYCLE_STAT(TEXT("Flow Field Steer"), STAT_FlowFieldSteer, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Flow Field Chasers"), STAT_FlowFieldChasers, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Flow Field Cells Projected"), STAT_FlowFieldCellsProjected, STATGROUP_SlashAI);
+
+namespace FlowField
+{
+	constexpr int32 Unreachable = MAX_int32;
+	constexpr int32 StraightCost = 10;
+	constexpr int32 DiagonalCost = 14;
+
+	/* 8방향 이웃 (앞 4개는 직선, 뒤 4개는 대각선) */
+	const FIntPoint Neighbors[8] = {
+		{ 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 },
+		{ 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 }
+	};
+
+	struct FOpenNode
+	{
+		int32 Cost;
+		int32 Index;
+	};
+}
+
+void UChaseFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UChaseFlowFieldSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UChaseFlowFieldSubsystem::Deinitialize()
+{
+	Chasers.Empty();
+	WalkableCache.Empty();
+	IntegrationCost.Empty();
+	FlowDirections.Empty();
+	bFieldValid = false;
+	Super::Deinitialize();
+}
+
+bool UChaseFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 1. 추격을 멈췄거나 대상이 바뀐 적은 뺌
+ * 2. 대상이 다른 칸으로 옮겨 갔으면 흐름장 재계산
+ * 3. 남은 적에게 이동 입력
+ */
+void UChaseFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	AActor* Target = FieldTarget.Get();
+	Chasers.RemoveAllSwap([Target](const TWeakObjectPtr<AEnemy>& WeakEnemy)
+	{
+		const AEnemy* Enemy = WeakEnemy.Get();
+		return Enemy == nullptr || Enemy->GetEnemyState() != EEnemyState::EES_Chasing || Enemy->GetCombatTarget() != Target;
+	}, EAllowShrinking::No);
+
+	SET_DWORD_STAT(STAT_FlowFieldChasers, Chasers.Num());
+	if (Target == nullptr || Chasers.IsEmpty())
+	{
+		FieldTarget = nullptr;
+		bFieldValid = false;
+		SET_DWORD_STAT(STAT_FlowFieldCellsProjected, 0);
+		return;
+	}
+
+	if (!bFieldValid || WorldToCell(Target->GetActorLocation()) != FieldOrigin)
+	{
+		RebuildField(Target->GetActorLocation());
+	}
+	else
+	{
+		SET_DWORD_STAT(STAT_FlowFieldCellsProjected, 0);
+	}
+
+	SteerChasers();
+}
+
+TStatId UChaseFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UChaseFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+bool UChaseFlowFieldSubsystem::AddChaser(AEnemy* Enemy, AActor* Target)
+{
+	if (Enemy == nullptr || Target == nullptr) return false;
+
+	/* 흐름장은 한 번에 한 대상만 (추격자가 없으면 새 대상으로 바꿈) */
+	AActor* CurrentTarget = FieldTarget.Get();
+	if (CurrentTarget && CurrentTarget != Target && !Chasers.IsEmpty()) return false;
+
+	if (CurrentTarget != Target || !bFieldValid)
+	{
+		FieldTarget = Target;
+		RebuildField(Target->GetActorLocation());
+	}
+
+	FVector Direction;
+	if (!SampleDirection(Enemy->GetActorLocation(), Direction)) return false;
+
+	Chasers.AddUnique(Enemy);
+	return true;
+}
+
+bool UChaseFlowFieldSubsystem::SampleDirection(const FVector& Location, FVector& OutDirection) const
+{
+	if (!bFieldValid) return false;
+
+	const int32 Index = CellToIndex(WorldToCell(Location));
+	if (Index == INDEX_NONE || IntegrationCost[Index] == FlowField::Unreachable) return false;
+
+	const FVector2f& Flow = FlowDirections[Index];
+	OutDirection = FVector(Flow.X, Flow.Y, 0.f);
+	return true;
+}
+
+FIntPoint UChaseFlowFieldSubsystem::WorldToCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+int32 UChaseFlowFieldSubsystem::CellToIndex(const FIntPoint& Cell) const
+{
+	const int32 GridSize = GetGridSize();
+	const int32 LocalX = Cell.X - FieldOrigin.X + HalfExtentCells;
+	const int32 LocalY = Cell.Y - FieldOrigin.Y + HalfExtentCells;
+	if (LocalX < 0 || LocalY < 0 || LocalX >= GridSize || LocalY >= GridSize) return INDEX_NONE;
+	return LocalY * GridSize + LocalX;
+}
+
+bool UChaseFlowFieldSubsystem::IsCellWalkable(const FIntPoint& Cell, double ProbeZ)
+{
+	const FIntVector CacheKey(Cell.X, Cell.Y, FMath::FloorToInt32(ProbeZ / FMath::Max(ProjectionHeight, 1.f)));
+	if (const bool* Cached = WalkableCache.Find(CacheKey)) return *Cached;
+
+	bool bWalkable = false;
+	if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		const FVector CellCenter((Cell.X + 0.5) * CellSize, (Cell.Y + 0.5) * CellSize, ProbeZ);
+		FNavLocation Projected;
+		bWalkable = NavSys->ProjectPointToNavigation(CellCenter, Projected, FVector(CellSize * 0.5f, CellSize * 0.5f, ProjectionHeight));
+	}
+	WalkableCache.Add(CacheKey, bWalkable);
+	return bWalkable;
+}
+
+void UChaseFlowFieldSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	WalkableCache.Reset();
+	bFieldValid = false;
+}
+
+/**
+ * 대상 칸에서 시작하는 다익스트라(8방향, 직선 10 / 대각선 14)로 칸마다 대상까지의 비용을 구하고,
+ * 칸의 방향은 비용이 가장 낮은 이웃 칸을 향하게 합니다.
+ * 대각선은 양옆 직선 칸이 모두 통과 가능할 때만 허용해 벽 모서리를 자르지 않습니다.
+ */
+void UChaseFlowFieldSubsystem::RebuildField(const FVector& TargetLocation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlowFieldBuild);
+
+	const int32 GridSize = GetGridSize();
+	const int32 NumCells = GridSize * GridSize;
+	FieldOrigin = WorldToCell(TargetLocation);
+
+	/* 격자가 여러 번 옮겨 가면 캐시가 계속 커지므로 격자 몇 장 분량을 넘으면 비움 */
+	if (WalkableCache.Num() > NumCells * 4)
+	{
+		WalkableCache.Reset();
+	}
+
+	const int32 NumCachedBefore = WalkableCache.Num();
+	TBitArray<> Walkable(false, NumCells);
+	for (int32 Y = 0; Y < GridSize; ++Y)
+	{
+		for (int32 X = 0; X < GridSize; ++X)
+		{
+			const FIntPoint Cell(FieldOrigin.X + X - HalfExtentCells, FieldOrigin.Y + Y - HalfExtentCells);
+			Walkable[Y * GridSize + X] = IsCellWalkable(Cell, TargetLocation.Z);
+		}
+	}
+	SET_DWORD_STAT(STAT_FlowFieldCellsProjected, FMath::Max(WalkableCache.Num() - NumCachedBefore, 0));
+
+	IntegrationCost.Init(FlowField::Unreachable, NumCells);
+	FlowDirections.Init(FVector2f::ZeroVector, NumCells);
+
+	const int32 GoalIndex = HalfExtentCells * GridSize + HalfExtentCells;
+	const auto CostLess = [](const FlowField::FOpenNode& A, const FlowField::FOpenNode& B) { return A.Cost < B.Cost; };
+	TArray<FlowField::FOpenNode> Open;
+	Open.Reserve(NumCells);
+	IntegrationCost[GoalIndex] = 0;
+	Open.HeapPush({ 0, GoalIndex }, CostLess);
+
+	while (!Open.IsEmpty())
+	{
+		FlowField::FOpenNode Node;
+		Open.HeapPop(Node, CostLess, EAllowShrinking::No);
+		if (Node.Cost > IntegrationCost[Node.Index]) continue;
+
+		const int32 X = Node.Index % GridSize;
+		const int32 Y = Node.Index / GridSize;
+		for (int32 N = 0; N < 8; ++N)
+		{
+			const int32 NX = X + FlowField::Neighbors[N].X;
+			const int32 NY = Y + FlowField::Neighbors[N].Y;
+			if (NX < 0 || NY < 0 || NX >= GridSize || NY >= GridSize) continue;
+
+			const int32 NeighborIndex = NY * GridSize + NX;
+			if (!Walkable[NeighborIndex]) continue;
+
+			const bool bDiagonal = N >= 4;
+			if (bDiagonal && (!Walkable[Y * GridSize + NX] || !Walkable[NY * GridSize + X])) continue;
+
+			const int32 NewCost = Node.Cost + (bDiagonal ? FlowField::DiagonalCost : FlowField::StraightCost);
+			if (NewCost < IntegrationCost[NeighborIndex])
+			{
+				IntegrationCost[NeighborIndex] = NewCost;
+				Open.HeapPush({ NewCost, NeighborIndex }, CostLess);
+			}
+		}
+	}
+
+	for (int32 Index = 0; Index < NumCells; ++Index)
+	{
+		if (IntegrationCost[Index] == FlowField::Unreachable || Index == GoalIndex) continue;
+
+		const int32 X = Index % GridSize;
+		const int32 Y = Index / GridSize;
+		int32 BestCost = IntegrationCost[Index];
+		FIntPoint BestStep(0, 0);
+		for (int32 N = 0; N < 8; ++N)
+		{
+			const int32 NX = X + FlowField::Neighbors[N].X;
+			const int32 NY = Y + FlowField::Neighbors[N].Y;
+			if (NX < 0 || NY < 0 || NX >= GridSize || NY >= GridSize) continue;
+			if (N >= 4 && (!Walkable[Y * GridSize + NX] || !Walkable[NY * GridSize + X])) continue;
+
+			const int32 NeighborCost = IntegrationCost[NY * GridSize + NX];
+			if (NeighborCost < BestCost)
+			{
+				BestCost = NeighborCost;
+				BestStep = FlowField::Neighbors[N];
+			}
+		}
+		FlowDirections[Index] = FVector2f(BestStep.X, BestStep.Y).GetSafeNormal();
+	}
+
+	bFieldValid = true;
+}
+
+/**
+ * 적마다: 자기 칸의 흐름 방향 (대상 칸이면 대상 쪽 직선) + 주변 적에게서 멀어지는 분리 벡터
+ * 분리 벡터는 가까울수록 강하게 (1 - 거리/반경) 가중합니다.
+ * 멈추는 거리는 적마다 GetChaseStopDistance() 로, AEnemy::ClassifyCombatTarget 과 같은 3D 거리로 비교합니다.
+ * (XY 거리로 멈추면 높이 차 때문에 공격 반경에 못 들어간 채 추격 상태에 머물 수 있음)
+ */
+void UChaseFlowFieldSubsystem::SteerChasers()
+{
+	SCOPE_CYCLE_COUNTER(STAT_FlowFieldSteer);
+
+	const AActor* Target = FieldTarget.Get();
+	const FVector TargetLocation = Target->GetActorLocation();
+	const UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>();
+
+	for (int32 Index = Chasers.Num() - 1; Index >= 0; --Index)
+	{
+		AEnemy* Enemy = Chasers[Index].Get();
+		const FVector Location = Enemy->GetActorLocation();
+		if (FVector::DistSquared(TargetLocation, Location) <= FMath::Square(Enemy->GetChaseStopDistance())) continue;
+		const FVector ToTarget = (TargetLocation - Location) * FVector(1.0, 1.0, 0.0);
+
+		FVector Direction;
+		if (!SampleDirection(Location, Direction))
+		{
+			Chasers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			FallBackToPath(Enemy);
+			continue;
+		}
+		if (Direction.IsNearlyZero())
+		{
+			Direction = ToTarget.GetSafeNormal();
+		}
+
+		if (SpatialHash && SeparationRadius > 0.f)
+		{
+			NearbyActors.Reset();
+			SpatialHash->QueryRadius(Location, SeparationRadius, ECombatActorType::ECAT_Enemy, NearbyActors);
+
+			FVector Separation = FVector::ZeroVector;
+			for (const AActor* Other : NearbyActors)
+			{
+				if (Other == Enemy) continue;
+				const FVector Away = (Location - Other->GetActorLocation()) * FVector(1.0, 1.0, 0.0);
+				const double Distance = Away.Size();
+				if (Distance <= UE_KINDA_SMALL_NUMBER) continue;
+				Separation += Away / Distance * (1.0 - Distance / SeparationRadius);
+			}
+			Direction += Separation * SeparationWeight;
+		}
+
+		Enemy->AddMovementInput(Direction.GetSafeNormal2D());
+	}
+}
+
+void UChaseFlowFieldSubsystem::FallBackToPath(AEnemy* Enemy)
+{
+	Enemy->ChaseAlongPath();
+}
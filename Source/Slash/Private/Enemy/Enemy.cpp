@@ -3,20 +3,32 @@
 
 #include "Enemy/Enemy.h"
 #include "AIController.h"
+#include "Enemy/EnemyAIManager.h"
+#include "Enemy/PathRequestSubsystem.h"
+#include "Enemy/ChaseFlowFieldSubsystem.h"
+#include "Enemy/PatrolRouteGraph.h"
+#include "Enemy/PatrolCrowdSubsystem.h"
+#include "Enemy/EnemyMovementComponent.h"
+#include "Combat/CombatSpatialHash.h"
 #include "Characters/SlashCharacter.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Perception/PawnSensingComponent.h"
+#include "Enemy/SightQueryComponent.h"
 #include "Components/AttributeComponent.h"
 #include "HUD/HealthBarComponent.h"
 #include "Item/Soul.h"
 #include "Navigation/PathFollowingComponent.h"
 #include "Item/Weapons/Weapon.h"
-#include "Item/Soul.h"
+#include "Pool/ActorPoolSubsystem.h"
 
-AEnemy::AEnemy()
+AEnemy::AEnemy(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UEnemyMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
-	PrimaryActorTick.bCanEverTick = true;
+	/* AI 판단은 UEnemyAIManager 가 일괄 처리하므로 액터 틱은 사용하지 않음 */
+	PrimaryActorTick.bCanEverTick = false;
+
+	/* 풀에서 생성된 적도 AI 컨트롤러가 빙의하도록 */
+	AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
 	Attribute = CreateDefaultSubobject<UAttributeComponent>(TEXT("Attributes"));
 
 	/* 메시(Mesh)의 충돌 타입을 '월드 다이내믹'으로 설정
@@ -43,14 +55,10 @@ AEnemy::AEnemy()
 	bUseControllerRotationYaw = false;
 	bUseControllerRotationRoll = false;
 
-	// TODO: ⛔ 기존 감지 시스템 제거
-	PawnSensing = CreateDefaultSubobject<UPawnSensingComponent>(TEXT("감지"));
-	PawnSensing->SightRadius = 4000.f;
-	PawnSensing->SetPeripheralVisionAngle(45.f);
-
-	// TODO: ✅ AI Perception System 도입
-	// AIPerception = CreateDefaultSubobject<UAIPerceptionComponent>(TEXT("AIPerception"));
-	// SightConfig = CreateDefaultSubobject<UAISenseConfig_Sight>(TEXT("SightConfig"));
+	/* 시야 판정은 UEnemyPerceptionSubsystem 이 모든 적을 모아 일괄 처리 */
+	SightQuery = CreateDefaultSubobject<USightQueryComponent>(TEXT("시야"));
+	SightQuery->SetSightRadius(4000.f);
+	SightQuery->SetPeripheralVisionAngle(45.f);
 }
 
 void AEnemy::BeginPlay()
@@ -63,14 +71,15 @@ void AEnemy::BeginPlay()
 	}
 
 	EnemyController = Cast<AAIController>(GetController());
+	ResolvePatrolWaypoint();
 	MoveToTarget(PatrolTarget);
 	
-	if (PawnSensing)
+	if (SightQuery)
 	{
-		PawnSensing->OnSeePawn.AddDynamic(this, &AEnemy::PawnSeen);
+		SightQuery->OnSeePawn.AddDynamic(this, &AEnemy::PawnSeen);
 	}
 	
-	Tags.Add(FName("Enemy"));
+	SetCombatantFlags(ECombatantFlags::ECF_Enemy, true);
 
 	UWorld* World = GetWorld();
 	if (World && WeaponClass)
@@ -79,17 +88,37 @@ void AEnemy::BeginPlay()
 		DefaultWeapon->Equip(GetMesh(), FName("RightHandSocket"), this, this);
 		EquippedWeapon = DefaultWeapon;
 	}
+
+	if (UEnemyAIManager* AIManager = World ? World->GetSubsystem<UEnemyAIManager>() : nullptr)
+	{
+		AIManager->RegisterEnemy(this);
+	}
+
+	if (UCombatSpatialHash* SpatialHash = World ? World->GetSubsystem<UCombatSpatialHash>() : nullptr)
+	{
+		SpatialHash->RegisterActor(this, ECombatActorType::ECAT_Enemy);
+	}
+
+	RegisterWithCrowd();
+}
+
+void AEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterFromAIManager();
+	UnregisterFromCrowd();
+	CancelPathRequest();
+	Super::EndPlay(EndPlayReason);
 }
 
 /**
- * 전투/순찰 대상을 주기적으로 확인하고 AI의 행동을 결정합니다.
+ * 전투/순찰 대상을 확인하고 AI의 행동을 결정합니다.
  * @param DeltaTime 프레임 간 경과 시간
  */
-void AEnemy::Tick(float DeltaTime)
+void AEnemy::UpdateAI(float DeltaTime)
 {
-	Super::Tick(DeltaTime);
 	if (IsDead()) return;
-	if (EnemyState > EEnemyState::EES_Patrolling)
+	UpdateMovementMode();
+	if (IsInCombat())
 	{
 		CheckCombatTarget();
 	}
@@ -107,17 +136,21 @@ void AEnemy::Tick(float DeltaTime)
  * - 공격 타이머를 초기화합니다.
  * - 체력바를 화면에서 숨깁니다.
  * - 캡슐 컴포넌트를 비활성화하여 충돌 처리를 중단합니다.
- * - 사망 후 지정된 시간(DeathLifeSpan)이 경과하면 캐릭터를 제거합니다.
+ * - 사망 후 지정된 시간(DeathLifeSpan)이 경과하면 풀로 돌아갑니다.
  */
 void AEnemy::Die()
 {
 	Super::Die();
 	EnemyState = EEnemyState::EES_Dead;
+	UpdateMovementMode();
+	UnregisterFromAIManager();
+	UnregisterFromCrowd();
+	CancelPathRequest();
 	// PlayDeathMontage();
 	ClearAttackTimer();
 	HideHealthBar();
 	DisableCapsule();
-	SetLifeSpan(DeathLifeSpan);
+	GetWorldTimerManager().SetTimer(DeathTimer, this, &AEnemy::ReturnToPool, DeathLifeSpan);
 	GetCharacterMovement()->bOrientRotationToMovement = false;
 	SetWeaponCollisionEnabled(ECollisionEnabled::NoCollision);
 	DisableMeshCollision();
@@ -132,12 +165,34 @@ void AEnemy::Die()
 void AEnemy::MoveToTarget(AActor* Target)
 {
 	if (EnemyController == nullptr || Target == nullptr) return;
+
+	/* 경로 탐색은 서브시스템이 중복을 걸러 프레임당 정해진 수만큼 비동기로 처리 */
+	if (UPathRequestSubsystem* PathRequests = GetWorld()->GetSubsystem<UPathRequestSubsystem>())
+	{
+		PathRequests->RequestMove(EnemyController, Target, AcceptanceRadius);
+		return;
+	}
+
 	FAIMoveRequest MoveRequest; // AI 이동 요청 생성
 	MoveRequest.SetGoalActor(Target); // 목표 액터 설정
 	MoveRequest.SetAcceptanceRadius(AcceptanceRadius); // 목표에 얼마나 가까이 가면 도착으로 간주할지 설정
 	EnemyController->MoveTo(MoveRequest); // 이동 요청 실행, 이동 경로를 NavPath에 저장
 }
 
+void AEnemy::ChaseAlongPath()
+{
+	MoveToTarget(CombatTarget);
+}
+
+void AEnemy::CancelPathRequest()
+{
+	if (EnemyController == nullptr) return;
+	if (UPathRequestSubsystem* PathRequests = GetWorld()->GetSubsystem<UPathRequestSubsystem>())
+	{
+		PathRequests->CancelRequest(EnemyController);
+	}
+}
+
 /**
  * 대상이 지정된 반경 내에 있는지 확인합니다.
  * @param Target 확인할 대상 액터
@@ -148,8 +203,34 @@ void AEnemy::MoveToTarget(AActor* Target)
 bool AEnemy::InTargetRange(AActor* Target, double Radius)
 {
 	if (Target == nullptr) return false;
-	const double DistanceToTarget = (Target->GetActorLocation() - GetActorLocation()).Size();
-	return DistanceToTarget <= Radius;
+	return FVector::DistSquared(Target->GetActorLocation(), GetActorLocation()) <= Radius * Radius;
+}
+
+/**
+ * 전투 대상과의 거리 구간을 제곱 거리 한 번으로 분류합니다.
+ * 대상이 없으면 CombatRadius 밖으로 취급합니다.
+ */
+void AEnemy::ClassifyCombatTarget()
+{
+	if (CombatTarget == nullptr)
+	{
+		CombatTargetRange = ECombatTargetRange::ECTR_OutsideCombat;
+		return;
+	}
+
+	const double DistanceSquared = FVector::DistSquared(CombatTarget->GetActorLocation(), GetActorLocation());
+	if (DistanceSquared <= AttackRadius * AttackRadius)
+	{
+		CombatTargetRange = ECombatTargetRange::ECTR_InsideAttack;
+	}
+	else if (DistanceSquared <= CombatRadius * CombatRadius)
+	{
+		CombatTargetRange = ECombatTargetRange::ECTR_InsideCombat;
+	}
+	else
+	{
+		CombatTargetRange = ECombatTargetRange::ECTR_OutsideCombat;
+	}
 }
 
 /**
@@ -158,8 +239,8 @@ bool AEnemy::InTargetRange(AActor* Target, double Radius)
  */
 AActor* AEnemy::ChoosePatrolTarget()
 {
-	// 목표 배열 생성
-	TArray<AActor*> ValidTargets;
+	// 목표 배열 생성 (대부분 지점이 몇 개뿐이므로 스택에)
+	TArray<AActor*, TInlineAllocator<16>> ValidTargets;
 	for (AActor* Target : PatrolTargets)
 	{
 		if (Target != PatrolTarget)
@@ -209,7 +290,7 @@ bool AEnemy::CanChaseTarget()
 
 bool AEnemy::IsTargetPlayer(const APawn* Target)
 {
-	return Target && Target->ActorHasTag(FName("EngageableTarget"));
+	return EnumHasAnyFlags(GetActorCombatantFlags(Target), ECombatantFlags::ECF_EngageableTarget);
 }
 
 /**
@@ -222,6 +303,7 @@ void AEnemy::PawnSeen(APawn* SeenPawn)
 
 	if (bShouldChaseTarget)
 	{
+		PromoteAIUpdate();
 		CombatTarget = SeenPawn;
 		ClearPatrolTimer();
 		ChaseTarget();
@@ -240,7 +322,7 @@ bool AEnemy::CanAttack()
 
 /**
  * AI 캐릭터가 파괴될 때 호출됩니다.
- * 기본 클래스를 통해 파괴 프로세스를 처리한 후, 장착된 무기(EquippedWeapon)가 있을 경우 해당 무기를 파괴합니다.
+ * 장착된 무기(EquippedWeapon)는 풀에서 적과 함께 재사용되므로, 적이 실제로 파괴될 때만 함께 파괴합니다.
  */
 void AEnemy::Destroyed()
 {
@@ -256,9 +338,35 @@ void AEnemy::Destroyed()
  */
 void AEnemy::PatrolTimerFinished()
 {
+	if (PatrolRoute && PatrolRoute->IsValidLeg(PatrolLegIndex))
+	{
+		FollowPatrolLeg();
+		return;
+	}
 	MoveToTarget(PatrolTarget);
 }
 
+void AEnemy::ResolvePatrolWaypoint()
+{
+	PatrolWaypointIndex = PatrolRoute ? PatrolRoute->FindWaypointIndex(PatrolTarget) : INDEX_NONE;
+	PatrolLegIndex = INDEX_NONE;
+}
+
+void AEnemy::FollowPatrolLeg()
+{
+	const FNavPathSharedPtr LegPath = PatrolRoute->GetLegPath(PatrolLegIndex);
+	if (EnemyController == nullptr || !LegPath.IsValid())
+	{
+		MoveToTarget(PatrolTarget);
+		return;
+	}
+
+	CancelPathRequest();
+	FAIMoveRequest MoveRequest(PatrolTarget);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	EnemyController->RequestMove(MoveRequest, LegPath);
+}
+
 void AEnemy::HideHealthBar()
 {
 	if (HealthBarWidget)
@@ -285,22 +393,23 @@ void AEnemy::StartPatrolling()
 {
 	EnemyState = EEnemyState::EES_Patrolling;
 	GetCharacterMovement()->MaxWalkSpeed = PatrollingSpeed; // 순찰 속도로 변경/ 상태를 순찰로 변경
+	UpdateMovementMode();
 	MoveToTarget(PatrolTarget); // 순찰 지점으로 이동
 }
 
 bool AEnemy::IsOutsideCombatRadius()
 {
-	return !InTargetRange(CombatTarget, CombatRadius);
+	return CombatTargetRange == ECombatTargetRange::ECTR_OutsideCombat;
 }
 
 bool AEnemy::IsOutsideAttackRadius()
 {
-	return !InTargetRange(CombatTarget, AttackRadius);
+	return CombatTargetRange != ECombatTargetRange::ECTR_InsideAttack;
 }
 
 bool AEnemy::IsInsideAttackRadius()
 {
-	return InTargetRange(CombatTarget, AttackRadius);
+	return CombatTargetRange == ECombatTargetRange::ECTR_InsideAttack;
 }
 
 bool AEnemy::IsChasing()
@@ -335,9 +444,33 @@ void AEnemy::ChaseTarget()
 {
 	EnemyState = EEnemyState::EES_Chasing;
 	GetCharacterMovement()->MaxWalkSpeed = ChasingSpeed;
+	UpdateMovementMode();
+
+	/* 같은 대상을 쫓는 적들은 공유 흐름장을 따라 이동 (경로 탐색 없음) */
+	UChaseFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UChaseFlowFieldSubsystem>();
+	if (FlowField && FlowField->AddChaser(this, CombatTarget))
+	{
+		CancelPathRequest();
+		if (EnemyController)
+		{
+			EnemyController->StopMovement();
+		}
+		return;
+	}
 	MoveToTarget(CombatTarget);
 }
 
+void AEnemy::UpdateMovementMode()
+{
+	if (UEnemyMovementComponent* EnemyMovement = GetCharacterMovement<UEnemyMovementComponent>())
+	{
+		const bool bFullPhysicsState = EnemyState == EEnemyState::EES_Dead || EnemyState == EEnemyState::EES_Chasing || EnemyState == EEnemyState::EES_Attacking;
+		const bool bSimplified = bAllowSimplifiedMovement && !bFullPhysicsState &&
+			(EnemyState == EEnemyState::EES_Patrolling || !WasRecentlyRendered(OffscreenMovementDelay));
+		EnemyMovement->SetSimplifiedMovement(bSimplified);
+	}
+}
+
 bool AEnemy::IsEngaged()
 {
 	return EnemyState == EEnemyState::EES_Engaged;
@@ -351,6 +484,7 @@ bool AEnemy::IsEngaged()
  */
 void AEnemy::CheckCombatTarget()
 {
+	ClassifyCombatTarget();
 	if (IsOutsideCombatRadius())
 	{
 		ClearAttackTimer();
@@ -371,7 +505,7 @@ void AEnemy::CheckCombatTarget()
 
 bool AEnemy::ActorsSameType(AActor* OtherActor)
 {
-	return GetOwner()->ActorHasTag(TEXT("Enemy")) && OtherActor->ActorHasTag(TEXT("Enemy"));
+	return EnumHasAnyFlags(GetActorCombatantFlags(GetOwner()) & GetActorCombatantFlags(OtherActor), ECombatantFlags::ECF_Enemy);
 }
 
 void AEnemy::ActivateArmCollision(bool bActivate)
@@ -390,7 +524,20 @@ void AEnemy::CheckPatrolTarget()
 {
 	if (InTargetRange(PatrolTarget, PatrolRadius))
 	{
-		PatrolTarget = ChoosePatrolTarget();
+		/* 그래프가 있으면 도착한 지점에서 나가는 구간 중 하나를 고름 (할당/경로 탐색 없음) */
+		const int32 NextLeg = PatrolRoute ? PatrolRoute->ChooseNextLeg(PatrolWaypointIndex) : INDEX_NONE;
+		if (NextLeg != INDEX_NONE)
+		{
+			PatrolLegIndex = NextLeg;
+			PatrolWaypointIndex = PatrolRoute->GetLeg(NextLeg).To;
+			PatrolTarget = PatrolRoute->GetWaypoint(PatrolWaypointIndex);
+		}
+		else
+		{
+			/* 그래프 밖 지점으로 가더라도 다음 도착 때 그 지점의 구간을 쓰도록 인덱스를 다시 찾음 */
+			PatrolTarget = ChoosePatrolTarget();
+			ResolvePatrolWaypoint();
+		}
 		const float WaitTime = FMath::RandRange(PatrolWaitMin, PatrolWaitMax);
 		GetWorldTimerManager().SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, WaitTime);
 	}
@@ -412,12 +559,14 @@ bool AEnemy::IsDead()
 void AEnemy::GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter)
 {
 	Super::GetHit_Implementation(ImpactPoint, Hitter);
+	PromoteAIUpdate();
 	if (!IsDead()) ShowHealthBar();
 	ClearPatrolTimer();
 	ClearAttackTimer();
 	SetWeaponCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	StopAttackMontage();
+	ClassifyCombatTarget();
 	if (IsInsideAttackRadius())
 	{
 		if (!IsDead()) StartAttackTimer();
@@ -447,6 +596,7 @@ float AEnemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AC
 {
 	HandleDamage(DamageAmount);
 	CombatTarget = EventInstigator->GetPawn();
+	ClassifyCombatTarget();
 	
 	if (IsInsideAttackRadius())
 	{
@@ -460,15 +610,210 @@ float AEnemy::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AC
 	return DamageAmount;
 }
 
-void AEnemy::SpawnSoul()
+void AEnemy::UnregisterFromAIManager()
+{
+	UWorld* World = GetWorld();
+	if (UEnemyAIManager* AIManager = World ? World->GetSubsystem<UEnemyAIManager>() : nullptr)
+	{
+		AIManager->UnregisterEnemy(this);
+	}
+}
+
+double AEnemy::GetDetectionRadius() const
+{
+	const double SightRadius = SightQuery ? SightQuery->GetSightRadius() : 0.0;
+	return FMath::Max(SightRadius, CombatRadius);
+}
+
+float AEnemy::GetPatrolState(FPatrolCrowdProxyState& OutState) const
+{
+	OutState.PatrolTargets = PatrolTargets;
+	OutState.PatrolTarget = PatrolTarget;
+	OutState.PatrolRoute = PatrolRoute;
+	OutState.PatrolWaypointIndex = PatrolWaypointIndex;
+	OutState.PatrolLegIndex = PatrolLegIndex;
+	OutState.Speed = PatrollingSpeed;
+	OutState.PatrolWaitMin = PatrolWaitMin;
+	OutState.PatrolWaitMax = PatrolWaitMax;
+	OutState.Health = Attribute ? Attribute->GetHealth() : 0.f;
+
+	const FTimerManager& TimerManager = GetWorldTimerManager();
+	return TimerManager.IsTimerActive(PatrolTimer) ? FMath::Max(TimerManager.GetTimerRemaining(PatrolTimer), UE_KINDA_SMALL_NUMBER) : 0.f;
+}
+
+void AEnemy::ApplyPatrolState(const FPatrolCrowdProxyState& State, float WaitRemaining)
+{
+	PatrolTargets = State.PatrolTargets;
+	PatrolTarget = State.PatrolTarget;
+	PatrolRoute = State.PatrolRoute;
+	PatrolWaypointIndex = State.PatrolWaypointIndex;
+	PatrolLegIndex = State.PatrolLegIndex;
+
+	if (Attribute && State.Health < Attribute->GetHealth())
+	{
+		Attribute->ReceiveDamage(Attribute->GetHealth() - State.Health);
+		if (HealthBarWidget)
+		{
+			HealthBarWidget->SetHealthBarPercent(Attribute->GetHealthPercent());
+		}
+	}
+
+	ClearPatrolTimer();
+	if (WaitRemaining > 0.f)
+	{
+		CancelPathRequest();
+		if (EnemyController)
+		{
+			EnemyController->StopMovement();
+		}
+		GetWorldTimerManager().SetTimer(PatrolTimer, this, &AEnemy::PatrolTimerFinished, WaitRemaining);
+	}
+	else
+	{
+		MoveToTarget(PatrolTarget);
+	}
+}
+
+void AEnemy::RegisterWithCrowd()
+{
+	UWorld* World = GetWorld();
+	if (UPatrolCrowdSubsystem* Crowd = World ? World->GetSubsystem<UPatrolCrowdSubsystem>() : nullptr)
+	{
+		Crowd->RegisterEnemy(this);
+	}
+}
+
+void AEnemy::UnregisterFromCrowd()
 {
 	UWorld* World = GetWorld();
-	if (World && SoulClass && Attribute)
+	if (UPatrolCrowdSubsystem* Crowd = World ? World->GetSubsystem<UPatrolCrowdSubsystem>() : nullptr)
+	{
+		Crowd->UnregisterEnemy(this);
+	}
+}
+
+void AEnemy::PromoteAIUpdate()
+{
+	UWorld* World = GetWorld();
+	if (UEnemyAIManager* AIManager = World ? World->GetSubsystem<UEnemyAIManager>() : nullptr)
+	{
+		AIManager->PromoteToFullRate(this);
+	}
+}
+
+void AEnemy::SpawnSoul()
+{
+	UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+	if (Pool && SoulClass && Attribute)
 	{
-		ASoul* SpawnSoul = World->SpawnActor<ASoul>(SoulClass, GetActorLocation(), GetActorRotation());
+		ASoul* SpawnSoul = Pool->Acquire<ASoul>(SoulClass, GetActorTransform());
 		if (SpawnSoul)
 		{
 			SpawnSoul->SetSouls(Attribute->GetSouls());
 		}
 	}
-}
\ No newline at end of file
+}
+
+void AEnemy::ReturnToPool()
+{
+	if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+	{
+		Pool->Release(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+/**
+ * 풀에서 꺼내질 때 호출됩니다.
+ * 사망으로 바뀐 속성/태그/충돌/상태를 되돌리고 AI 매니저, 공간 해시, 시야 판정에 다시 등록합니다.
+ * 장착 무기는 적에게 붙은 채로 함께 재사용됩니다.
+ */
+void AEnemy::Activate()
+{
+	ResetCharacterState();
+	EnemyState = EEnemyState::EES_Patrolling;
+	CombatTargetRange = ECombatTargetRange::ECTR_OutsideCombat;
+	GetCharacterMovement()->bOrientRotationToMovement = true;
+	GetCharacterMovement()->MaxWalkSpeed = PatrollingSpeed;
+	UpdateMovementMode();
+
+	if (HealthBarWidget)
+	{
+		HealthBarWidget->SetVisibility(false);
+		HealthBarWidget->SetHealthBarPercent(1.f);
+	}
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	if (EquippedWeapon)
+	{
+		EquippedWeapon->SetActorHiddenInGame(false);
+	}
+
+	UWorld* World = GetWorld();
+	if (UEnemyAIManager* AIManager = World->GetSubsystem<UEnemyAIManager>())
+	{
+		AIManager->RegisterEnemy(this);
+	}
+	if (UCombatSpatialHash* SpatialHash = World->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->RegisterActor(this, ECombatActorType::ECAT_Enemy);
+	}
+	if (SightQuery)
+	{
+		SightQuery->SetSensingEnabled(true);
+	}
+	RegisterWithCrowd();
+
+	MoveToTarget(PatrolTarget);
+}
+
+/**
+ * 풀로 돌아갈 때 호출됩니다. 타이머와 이동을 멈추고 모든 서비스에서 빠진 뒤 숨겨집니다.
+ */
+void AEnemy::Deactivate()
+{
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	CancelPathRequest();
+	if (EnemyController)
+	{
+		EnemyController->StopMovement();
+	}
+	SetWeaponCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	UnregisterFromAIManager();
+	UnregisterFromCrowd();
+	if (UCombatSpatialHash* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+	if (SightQuery)
+	{
+		SightQuery->SetSensingEnabled(false);
+	}
+
+	HideHealthBar();
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	if (EquippedWeapon)
+	{
+		EquippedWeapon->SetActorHiddenInGame(true);
+	}
+}
+
+void AEnemy::SetPatrolTargets(const TArray<AActor*>& NewPatrolTargets, AActor* NewPatrolTarget)
+{
+	PatrolTargets = NewPatrolTargets;
+	PatrolTarget = NewPatrolTarget;
+	ResolvePatrolWaypoint();
+
+	/* Activate 가 이전 순찰 지점으로 보낸 이동을 새 지점으로 교체 */
+	if (EnemyState == EEnemyState::EES_Patrolling)
+	{
+		ClearPatrolTimer();
+		MoveToTarget(PatrolTarget);
+	}
+}
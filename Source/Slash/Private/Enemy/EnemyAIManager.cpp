@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/EnemyAIManager.h"
+#include "Enemy/Enemy.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy AI Update"), STAT_EnemyAIUpdate, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Enemies"), STAT_RegisteredEnemies, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Full Rate Updates"), STAT_FullRateUpdates, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Budgeted Updates"), STAT_BudgetedUpdates, STATGROUP_SlashAI);
+
+void UEnemyAIManager::Deinitialize()
+{
+	Enemies.Empty();
+	UpdateStates.Empty();
+	Super::Deinitialize();
+}
+
+bool UEnemyAIManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 등록된 모든 적의 AI 판단을 한 번의 루프에서 처리합니다.
+ * 1. 전투 중이거나 승격된 적, 주기가 0 인 등급의 적은 매 프레임 판단
+ * 2. 나머지는 등급별 주기가 지난 적만 MaxUpdateMilliseconds 예산 안에서 라운드 로빈으로 판단
+ * @param DeltaTime 프레임 간 경과 시간
+ */
+void UEnemyAIManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyAIUpdate);
+
+	FVector ViewLocation = FVector::ZeroVector;
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	if (PlayerPawn)
+	{
+		ViewLocation = PlayerPawn->GetActorLocation();
+	}
+
+	bIsUpdating = true;
+
+	int32 NumFullRate = 0;
+	const int32 NumEnemies = Enemies.Num();
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		AEnemy* Enemy = Enemies[Index];
+		if (Enemy == nullptr) continue;
+
+		FEnemyAIUpdateState& State = UpdateStates[Index];
+		State.TimeSinceUpdate += DeltaTime;
+		State.Tier = (State.bPromoted || Enemy->IsInCombat()) ? 0 : ComputeTier(Enemy, ViewLocation, PlayerPawn != nullptr);
+
+		const bool bFullRate = State.bPromoted || Enemy->IsInCombat() || GetTierInterval(State.Tier) <= 0.f;
+		ApplyAnimUpdateRate(Enemy, State, Enemy->IsInCombat() ? 1 : GetTierAnimUpdateRate(State.Tier));
+		if (bFullRate)
+		{
+			const float ElapsedTime = State.TimeSinceUpdate;
+			State.TimeSinceUpdate = 0.f;
+			State.bPromoted = false;
+			Enemy->UpdateAI(ElapsedTime);
+			++NumFullRate;
+		}
+	}
+
+	int32 NumBudgeted = 0;
+	if (NumEnemies > 0)
+	{
+		const double Deadline = FPlatformTime::Seconds() + MaxUpdateMilliseconds / 1000.0;
+		int32 Visited = 0;
+		for (; Visited < NumEnemies; ++Visited)
+		{
+			const int32 Index = (RoundRobinCursor + Visited) % NumEnemies;
+			AEnemy* Enemy = Enemies[Index];
+			if (Enemy == nullptr) continue;
+
+			FEnemyAIUpdateState& State = UpdateStates[Index];
+			if (State.TimeSinceUpdate <= 0.f || State.TimeSinceUpdate < GetTierInterval(State.Tier)) continue;
+
+			const float ElapsedTime = State.TimeSinceUpdate;
+			State.TimeSinceUpdate = 0.f;
+			Enemy->UpdateAI(ElapsedTime);
+			++NumBudgeted;
+
+			// 시간 측정 비용을 줄이기 위해 몇 명마다 한 번씩만 예산을 확인
+			if ((NumBudgeted & 7) == 0 && FPlatformTime::Seconds() > Deadline)
+			{
+				++Visited;
+				break;
+			}
+		}
+		RoundRobinCursor = (RoundRobinCursor + Visited) % NumEnemies;
+	}
+
+	bIsUpdating = false;
+
+	if (bNeedsCompaction)
+	{
+		CompactEnemies();
+	}
+
+	SET_DWORD_STAT(STAT_RegisteredEnemies, Enemies.Num());
+	SET_DWORD_STAT(STAT_FullRateUpdates, NumFullRate);
+	SET_DWORD_STAT(STAT_BudgetedUpdates, NumBudgeted);
+}
+
+TStatId UEnemyAIManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyAIManager, STATGROUP_Tickables);
+}
+
+void UEnemyAIManager::RegisterEnemy(AEnemy* Enemy)
+{
+	if (Enemy == nullptr || Enemies.Contains(Enemy)) return;
+	Enemies.Add(Enemy);
+	UpdateStates.AddDefaulted();
+
+	if (USkeletalMeshComponent* Mesh = Enemy->GetMesh())
+	{
+		Mesh->bEnableUpdateRateOptimizations = true;
+		Mesh->EnableExternalTickRateControl(true);
+	}
+}
+
+void UEnemyAIManager::UnregisterEnemy(AEnemy* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index == INDEX_NONE) return;
+
+	// 사망 몽타주 등은 매 프레임 재생되도록 외부 주기 제어를 해제
+	if (USkeletalMeshComponent* Mesh = Enemy->GetMesh())
+	{
+		Mesh->EnableExternalTickRateControl(false);
+		Mesh->EnableExternalInterpolation(false);
+	}
+
+	if (bIsUpdating)
+	{
+		// 순회 중에는 배열을 건드리지 않고 슬롯만 비운 뒤 Tick 끝에서 정리
+		Enemies[Index] = nullptr;
+		bNeedsCompaction = true;
+	}
+	else
+	{
+		Enemies.RemoveAt(Index);
+		UpdateStates.RemoveAt(Index);
+	}
+}
+
+void UEnemyAIManager::PromoteToFullRate(AEnemy* Enemy)
+{
+	const int32 Index = Enemies.Find(Enemy);
+	if (Index != INDEX_NONE)
+	{
+		UpdateStates[Index].bPromoted = true;
+		UpdateStates[Index].Tier = 0;
+	}
+}
+
+void UEnemyAIManager::CompactEnemies()
+{
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		if (Enemies[Index] == nullptr)
+		{
+			Enemies.RemoveAt(Index);
+			UpdateStates.RemoveAt(Index);
+		}
+	}
+	bNeedsCompaction = false;
+}
+
+int32 UEnemyAIManager::ComputeTier(const AEnemy* Enemy, const FVector& ViewLocation, bool bHasViewLocation) const
+{
+	const int32 NumTiers = SignificanceTiers.Num();
+	if (NumTiers == 0 || !bHasViewLocation) return 0;
+
+	const double DistanceSquared = FVector::DistSquared(Enemy->GetActorLocation(), ViewLocation);
+	int32 Tier = NumTiers - 1;
+	for (int32 Index = 0; Index < NumTiers; ++Index)
+	{
+		const double MaxDistance = SignificanceTiers[Index].MaxDistance;
+		if (DistanceSquared <= MaxDistance * MaxDistance)
+		{
+			Tier = Index;
+			break;
+		}
+	}
+
+	if (!Enemy->WasRecentlyRendered(0.2f))
+	{
+		Tier = FMath::Min(Tier + OffscreenTierPenalty, NumTiers - 1);
+	}
+	return Tier;
+}
+
+float UEnemyAIManager::GetTierInterval(int32 Tier) const
+{
+	return SignificanceTiers.IsValidIndex(Tier) ? SignificanceTiers[Tier].UpdateInterval : 0.f;
+}
+
+int32 UEnemyAIManager::GetTierAnimUpdateRate(int32 Tier) const
+{
+	return SignificanceTiers.IsValidIndex(Tier) ? FMath::Max(SignificanceTiers[Tier].AnimUpdateRate, 1) : 1;
+}
+
+void UEnemyAIManager::ApplyAnimUpdateRate(AEnemy* Enemy, FEnemyAIUpdateState& State, int32 AnimUpdateRate) const
+{
+	if (State.AnimUpdateRate == AnimUpdateRate) return;
+	State.AnimUpdateRate = AnimUpdateRate;
+
+	if (USkeletalMeshComponent* Mesh = Enemy->GetMesh())
+	{
+		Mesh->SetExternalTickRate(static_cast<uint8>(FMath::Min(AnimUpdateRate, 255)));
+		Mesh->EnableExternalInterpolation(AnimUpdateRate > 1);
+	}
+}
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/EnemyAnimInstance.h"
+#include "Enemy/Enemy.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+void UEnemyAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	Enemy = Cast<AEnemy>(TryGetPawnOwner());
+	if (Enemy)
+	{
+		EnemyMovement = Enemy->GetCharacterMovement();
+	}
+}
+
+void UEnemyAnimInstance::NativeUpdateAnimation(float DeltaTime)
+{
+	Super::NativeUpdateAnimation(DeltaTime);
+
+	if (EnemyMovement)
+	{
+		Snapshot.Velocity = EnemyMovement->Velocity;
+		Snapshot.bIsFalling = EnemyMovement->IsFalling();
+		Snapshot.EnemyState = Enemy->GetEnemyState();
+		Snapshot.DeathPose = Enemy->GetDeathPose();
+	}
+}
+
+void UEnemyAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaTime)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaTime);
+
+	GroundSpeed = Snapshot.Velocity.Size2D();
+	IsFalling = Snapshot.bIsFalling;
+	EnemyState = Snapshot.EnemyState;
+	DeathPose = Snapshot.DeathPose;
+}
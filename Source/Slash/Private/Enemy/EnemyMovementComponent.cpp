@@ -0,0 +1,64 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/EnemyMovementComponent.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Movement Tick (Full)"), STAT_EnemyMovementTickFull, STATGROUP_SlashAI);
+DECLARE_CYCLE_STAT(TEXT("Enemy Movement Tick (Simplified)"), STAT_EnemyMovementTickSimplified, STATGROUP_SlashAI);
+DECLARE_CYCLE_STAT(TEXT("Enemy PhysWalking"), STAT_EnemyPhysWalking, STATGROUP_SlashAI);
+DECLARE_CYCLE_STAT(TEXT("Enemy PhysNavWalking"), STAT_EnemyPhysNavWalking, STATGROUP_SlashAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Full Movement"), STAT_EnemiesFullMovement, STATGROUP_SlashAI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Enemies Simplified Movement"), STAT_EnemiesSimplifiedMovement, STATGROUP_SlashAI);
+
+UEnemyMovementComponent::UEnemyMovementComponent()
+{
+	/* 간이 이동 중에도 이동 스윕은 유지 (다른 적/플레이어/부서지는 액터를 뚫고 지나가지 않게) */
+	NavAgentProps.bCanWalk = true;
+}
+
+/**
+ * 현재 모드에 맞는 통계로 전체 이동 틱(경로 따라가기, 회전 포함)을 잽니다.
+ */
+void UEnemyMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	const bool bSimplified = IsSimplifiedMovement();
+	FScopeCycleCounter CycleCounter(bSimplified ? GET_STATID(STAT_EnemyMovementTickSimplified) : GET_STATID(STAT_EnemyMovementTickFull));
+	if (bSimplified)
+	{
+		INC_DWORD_STAT(STAT_EnemiesSimplifiedMovement);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_EnemiesFullMovement);
+	}
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+}
+
+void UEnemyMovementComponent::SetSimplifiedMovement(bool bEnable)
+{
+	if (bEnable)
+	{
+		if (MovementMode == MOVE_Walking && GetNavData())
+		{
+			SetMovementMode(MOVE_NavWalking);
+		}
+	}
+	else if (MovementMode == MOVE_NavWalking)
+	{
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+void UEnemyMovementComponent::PhysWalking(float DeltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyPhysWalking);
+	Super::PhysWalking(DeltaTime, Iterations);
+}
+
+void UEnemyMovementComponent::PhysNavWalking(float DeltaTime, int32 Iterations)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyPhysNavWalking);
+	Super::PhysNavWalking(DeltaTime, Iterations);
+}
@@ -0,0 +1,213 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/EnemyPerceptionSubsystem.h"
+#include "Enemy/SightQueryComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Sight Query Cull"), STAT_SightQueryCull, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sight Requests"), STAT_SightRequests, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Sight Traces"), STAT_SightTraces, STATGROUP_SlashAI);
+
+void UEnemyPerceptionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	SightTraceDelegate.BindUObject(this, &UEnemyPerceptionSubsystem::OnSightTraceCompleted);
+}
+
+void UEnemyPerceptionSubsystem::Deinitialize()
+{
+	SightTraceDelegate.Unbind();
+	Sensors.Empty();
+	TimeUntilSense.Empty();
+	PendingTraces.Empty();
+	Super::Deinitialize();
+}
+
+bool UEnemyPerceptionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyPerceptionSubsystem::Tick(float DeltaTime)
+{
+	// 지난 프레임에 보낸 트레이스의 콜백은 이미 월드 틱 초반에 모두 처리됨
+	PendingTraces.Reset();
+
+	DueSensors.Reset();
+	for (int32 Index = 0; Index < Sensors.Num(); ++Index)
+	{
+		TimeUntilSense[Index] -= DeltaTime;
+		if (TimeUntilSense[Index] <= 0.f && Sensors[Index])
+		{
+			TimeUntilSense[Index] += Sensors[Index]->GetSensingInterval();
+			DueSensors.Add(Index);
+		}
+	}
+	SET_DWORD_STAT(STAT_SightRequests, DueSensors.Num());
+	if (DueSensors.Num() == 0) return;
+
+	GatherTargets();
+	if (Targets.Num() == 0) return;
+
+	CullSightRequests();
+	SubmitSightTraces();
+}
+
+TStatId UEnemyPerceptionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyPerceptionSubsystem, STATGROUP_Tickables);
+}
+
+void UEnemyPerceptionSubsystem::RegisterSensor(USightQueryComponent* Sensor)
+{
+	if (Sensor == nullptr || Sensors.Contains(Sensor)) return;
+	Sensors.Add(Sensor);
+
+	// 같은 프레임에 몰리지 않도록 첫 판정 시점을 주기 안에서 흩어둠
+	TimeUntilSense.Add(FMath::FRandRange(0.f, Sensor->GetSensingInterval()));
+}
+
+void UEnemyPerceptionSubsystem::UnregisterSensor(USightQueryComponent* Sensor)
+{
+	const int32 Index = Sensors.Find(Sensor);
+	if (Index != INDEX_NONE)
+	{
+		Sensors.RemoveAtSwap(Index);
+		TimeUntilSense.RemoveAtSwap(Index);
+	}
+}
+
+/**
+ * 시야 판정 대상인 플레이어 Pawn 을 모읍니다.
+ */
+void UEnemyPerceptionSubsystem::GatherTargets()
+{
+	Targets.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (Pawn && !Pawn->IsHidden())
+		{
+			Targets.Add(Pawn);
+		}
+	}
+}
+
+/**
+ * 감지기 정보를 SoA 배열로 모은 뒤 거리/시야각 판정을 분기 없이 한 번에 계산합니다.
+ * SelfToOther · Facing >= Cos(시야각) * |SelfToOther| 로 정규화 없이 시야각을 판정합니다.
+ */
+void UEnemyPerceptionSubsystem::CullSightRequests()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SightQueryCull);
+
+	const int32 NumDue = DueSensors.Num();
+	EyeX.SetNumUninitialized(NumDue);
+	EyeY.SetNumUninitialized(NumDue);
+	EyeZ.SetNumUninitialized(NumDue);
+	DirX.SetNumUninitialized(NumDue);
+	DirY.SetNumUninitialized(NumDue);
+	DirZ.SetNumUninitialized(NumDue);
+	RadiusSquared.SetNumUninitialized(NumDue);
+	VisionCosine.SetNumUninitialized(NumDue);
+
+	for (int32 Index = 0; Index < NumDue; ++Index)
+	{
+		const USightQueryComponent* Sensor = Sensors[DueSensors[Index]];
+		const FVector Eye = Sensor->GetSensorLocation();
+		const FVector Direction = Sensor->GetSensorDirection();
+		EyeX[Index] = Eye.X;
+		EyeY[Index] = Eye.Y;
+		EyeZ[Index] = Eye.Z;
+		DirX[Index] = Direction.X;
+		DirY[Index] = Direction.Y;
+		DirZ[Index] = Direction.Z;
+		RadiusSquared[Index] = FMath::Square(Sensor->GetSightRadius());
+		VisionCosine[Index] = Sensor->GetPeripheralVisionCosine();
+	}
+
+	Survivors.SetNumUninitialized(NumDue * Targets.Num());
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+	{
+		const FVector TargetLocation = Targets[TargetIndex]->GetActorLocation();
+		const float TargetX = TargetLocation.X;
+		const float TargetY = TargetLocation.Y;
+		const float TargetZ = TargetLocation.Z;
+		uint8* Result = Survivors.GetData() + TargetIndex * NumDue;
+
+		for (int32 Index = 0; Index < NumDue; ++Index)
+		{
+			const float DeltaX = TargetX - EyeX[Index];
+			const float DeltaY = TargetY - EyeY[Index];
+			const float DeltaZ = TargetZ - EyeZ[Index];
+			const float DistanceSquared = DeltaX * DeltaX + DeltaY * DeltaY + DeltaZ * DeltaZ;
+			const float Facing = DeltaX * DirX[Index] + DeltaY * DirY[Index] + DeltaZ * DirZ[Index];
+			Result[Index] = (DistanceSquared <= RadiusSquared[Index]) & (Facing >= VisionCosine[Index] * FMath::Sqrt(DistanceSquared));
+		}
+	}
+}
+
+/**
+ * 거리/시야각 판정을 통과한 쌍만 비동기 라인 트레이스로 보냅니다.
+ * 결과는 다음 프레임 월드 틱 초반에 OnSightTraceCompleted 로 돌아옵니다.
+ */
+void UEnemyPerceptionSubsystem::SubmitSightTraces()
+{
+	UWorld* World = GetWorld();
+	const int32 NumDue = DueSensors.Num();
+
+	for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+	{
+		APawn* Target = Targets[TargetIndex];
+		const uint8* Result = Survivors.GetData() + TargetIndex * NumDue;
+
+		for (int32 Index = 0; Index < NumDue; ++Index)
+		{
+			if (!Result[Index]) continue;
+
+			USightQueryComponent* Sensor = Sensors[DueSensors[Index]];
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SightQuery), true, Sensor->GetOwner());
+			QueryParams.AddIgnoredActor(Target);
+
+			FPendingSightTrace& Pending = PendingTraces.AddDefaulted_GetRef();
+			Pending.Sensor = Sensor;
+			Pending.Target = Target;
+			Pending.Handle = World->AsyncLineTraceByChannel(
+				EAsyncTraceType::Test,
+				FVector(EyeX[Index], EyeY[Index], EyeZ[Index]),
+				Target->GetActorLocation(),
+				ECollisionChannel::ECC_Visibility,
+				QueryParams,
+				FCollisionResponseParams::DefaultResponseParam,
+				&SightTraceDelegate,
+				PendingTraces.Num() - 1
+			);
+		}
+	}
+	SET_DWORD_STAT(STAT_SightTraces, PendingTraces.Num());
+}
+
+/**
+ * 가림 여부 트레이스 결과를 받아, 아무것도 막지 않았다면 감지기에 보인 Pawn 을 전달합니다.
+ * 감지기와 대상은 무시하므로 막힌 충돌이 없으면 시야가 확보된 것입니다.
+ */
+void UEnemyPerceptionSubsystem::OnSightTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 PendingIndex = static_cast<int32>(Datum.UserData);
+	if (!PendingTraces.IsValidIndex(PendingIndex)) return;
+	const FPendingSightTrace& Pending = PendingTraces[PendingIndex];
+	if (!(Pending.Handle == Handle)) return;
+
+	const bool bBlocked = Datum.OutHits.ContainsByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	USightQueryComponent* Sensor = Pending.Sensor.Get();
+	APawn* Target = Pending.Target.Get();
+	if (!bBlocked && Sensor && Target)
+	{
+		Sensor->NotifySeePawn(Target);
+	}
+}
@@ -0,0 +1,201 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/PathRequestSubsystem.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Path Request Submit"), STAT_PathRequestSubmit, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path Requests Pending"), STAT_PathRequestsPending, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path Requests In Flight"), STAT_PathRequestsInFlight, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path Requests Deduped"), STAT_PathRequestsDeduped, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path Requests Completed"), STAT_PathRequestsCompleted, STATGROUP_SlashAI);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Path Request Avg Latency (ms)"), STAT_PathRequestAvgLatency, STATGROUP_SlashAI);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Path Request Max Latency (ms)"), STAT_PathRequestMaxLatency, STATGROUP_SlashAI);
+
+void UPathRequestSubsystem::Deinitialize()
+{
+	Requests.Empty();
+	PendingOrder.Empty();
+	InFlightQueries.Empty();
+	Super::Deinitialize();
+}
+
+bool UPathRequestSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 지난 틱 이후 완료된 결과로 통계를 남기고, 대기열에서 이번 프레임 몫을 제출합니다.
+ * (결과 콜백은 내비게이션 시스템 틱에서 게임 스레드로 호출됨)
+ */
+void UPathRequestSubsystem::Tick(float DeltaTime)
+{
+	SET_DWORD_STAT(STAT_PathRequestsDeduped, NumDeduped);
+	SET_DWORD_STAT(STAT_PathRequestsCompleted, NumCompleted);
+	SET_FLOAT_STAT(STAT_PathRequestAvgLatency, NumCompleted > 0 ? TotalLatencyMs / NumCompleted : 0.0);
+	SET_FLOAT_STAT(STAT_PathRequestMaxLatency, MaxLatencyMs);
+	NumDeduped = 0;
+	NumCompleted = 0;
+	TotalLatencyMs = 0.0;
+	MaxLatencyMs = 0.0;
+
+	SubmitPendingRequests();
+
+	SET_DWORD_STAT(STAT_PathRequestsPending, PendingOrder.Num());
+	SET_DWORD_STAT(STAT_PathRequestsInFlight, InFlightQueries.Num());
+}
+
+TStatId UPathRequestSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPathRequestSubsystem, STATGROUP_Tickables);
+}
+
+/**
+ * 1. 같은 목표로 대기/탐색 중 → 버림
+ * 2. 이미 같은 목표로 이동 중 → 다른 목표로 가던 요청이 있으면 취소하고 버림
+ * 3. 다른 목표로 대기/탐색 중 → 목표를 바꾸고 (탐색 중이었으면) 다시 대기열로
+ * 4. 그 외 → 새 요청
+ */
+void UPathRequestSubsystem::RequestMove(AAIController* Controller, AActor* Goal, float AcceptanceRadius)
+{
+	if (Controller == nullptr || Goal == nullptr) return;
+
+	FPathRequest* Existing = Requests.Find(Controller);
+	if (Existing && Existing->Goal == Goal)
+	{
+		Existing->AcceptanceRadius = AcceptanceRadius;
+		++NumDeduped;
+		return;
+	}
+
+	if (IsMovingToGoal(Controller, Goal))
+	{
+		if (Existing)
+		{
+			CancelRequest(Controller);
+		}
+		++NumDeduped;
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Existing)
+	{
+		Existing->Goal = Goal;
+		Existing->AcceptanceRadius = AcceptanceRadius;
+		Existing->RequestTime = Now;
+		if (Existing->QueryId != INVALID_NAVQUERYID)
+		{
+			/* 탐색 중인 결과는 InFlightQueries 에 남아 있다가 도착하면 QueryId 가 달라 버려짐 */
+			Existing->QueryId = INVALID_NAVQUERYID;
+			PendingOrder.Add(Controller);
+		}
+		return;
+	}
+
+	FPathRequest& NewRequest = Requests.Add(Controller);
+	NewRequest.Goal = Goal;
+	NewRequest.AcceptanceRadius = AcceptanceRadius;
+	NewRequest.RequestTime = Now;
+	PendingOrder.Add(Controller);
+}
+
+void UPathRequestSubsystem::CancelRequest(AAIController* Controller)
+{
+	if (Requests.Remove(Controller) > 0)
+	{
+		PendingOrder.Remove(Controller);
+	}
+}
+
+bool UPathRequestSubsystem::IsMovingToGoal(const AAIController* Controller, const AActor* Goal)
+{
+	const UPathFollowingComponent* PathFollowing = Controller->GetPathFollowingComponent();
+	return PathFollowing
+		&& PathFollowing->GetStatus() == EPathFollowingStatus::Moving
+		&& PathFollowing->GetMoveGoal() == Goal;
+}
+
+void UPathRequestSubsystem::SubmitPendingRequests()
+{
+	if (PendingOrder.IsEmpty()) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_PathRequestSubmit);
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (NavSys == nullptr) return;
+
+	int32 NumProcessed = 0;
+	int32 NumSubmitted = 0;
+	const int32 Budget = FMath::Max(MaxQueriesPerFrame, 1);
+	while (NumProcessed < PendingOrder.Num() && NumSubmitted < Budget)
+	{
+		const TWeakObjectPtr<AAIController> WeakController = PendingOrder[NumProcessed++];
+		AAIController* Controller = WeakController.Get();
+		FPathRequest* Request = Requests.Find(WeakController);
+		AActor* Goal = Request ? Request->Goal.Get() : nullptr;
+		if (Controller == nullptr || Goal == nullptr)
+		{
+			Requests.Remove(WeakController);
+			continue;
+		}
+
+		FAIMoveRequest MoveRequest(Goal);
+		MoveRequest.SetAcceptanceRadius(Request->AcceptanceRadius);
+
+		FPathFindingQuery Query;
+		if (!Controller->BuildPathfindingQuery(MoveRequest, Query))
+		{
+			Requests.Remove(WeakController);
+			continue;
+		}
+
+		Request->QueryId = NavSys->FindPathAsync(
+			Query.NavAgentProperties,
+			Query,
+			FNavPathQueryDelegate::CreateUObject(this, &UPathRequestSubsystem::OnPathFound),
+			EPathFindingMode::Regular
+		);
+		InFlightQueries.Add(Request->QueryId, WeakController);
+		++NumSubmitted;
+	}
+	PendingOrder.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+}
+
+/**
+ * 컨트롤러가 그 사이 사라졌거나, 취소됐거나, 목표가 바뀌어 다른 쿼리를 기다리는 중이면 결과를 버립니다.
+ * 성공한 경로는 목표 액터 추적을 켠 뒤 RequestMove 로 넘깁니다. (AAIController::MoveTo 와 같은 설정)
+ */
+void UPathRequestSubsystem::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	TWeakObjectPtr<AAIController> WeakController;
+	if (!InFlightQueries.RemoveAndCopyValue(QueryId, WeakController)) return;
+
+	FPathRequest* Request = Requests.Find(WeakController);
+	if (Request == nullptr || Request->QueryId != QueryId) return;
+
+	const FPathRequest Completed = *Request;
+	Requests.Remove(WeakController);
+
+	const double LatencyMs = (FPlatformTime::Seconds() - Completed.RequestTime) * 1000.0;
+	++NumCompleted;
+	TotalLatencyMs += LatencyMs;
+	MaxLatencyMs = FMath::Max(MaxLatencyMs, LatencyMs);
+
+	AAIController* Controller = WeakController.Get();
+	AActor* Goal = Completed.Goal.Get();
+	if (Controller == nullptr || Goal == nullptr) return;
+	if (Result != ENavigationQueryResult::Success || !Path.IsValid()) return;
+
+	Path->SetGoalActorObservation(*Goal, 100.f);
+	Path->EnableRecalculationOnInvalidation(true);
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(Completed.AcceptanceRadius);
+	Controller->RequestMove(MoveRequest, Path);
+}
@@ -0,0 +1,408 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/PatrolCrowdSubsystem.h"
+#include "Enemy/Enemy.h"
+#include "Enemy/PatrolRouteGraph.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "NavigationSystem.h"
+#include "Pool/ActorPoolSubsystem.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Patrol Crowd Update"), STAT_PatrolCrowdUpdate, STATGROUP_SlashAI);
+DECLARE_CYCLE_STAT(TEXT("Patrol Crowd Promote/Demote"), STAT_PatrolCrowdSwap, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Patrol Crowd Proxies"), STAT_PatrolCrowdProxies, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Patrol Crowd Promotions"), STAT_PatrolCrowdPromotions, STATGROUP_SlashAI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Patrol Crowd Demotions"), STAT_PatrolCrowdDemotions, STATGROUP_SlashAI);
+
+void UPatrolCrowdSubsystem::Deinitialize()
+{
+	Groups.Empty();
+	Enemies.Empty();
+	PendingPromotions.Empty();
+	PendingDemotions.Empty();
+	ProxyRenderer = nullptr;
+	NumProxies = 0;
+	Super::Deinitialize();
+}
+
+bool UPatrolCrowdSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+/**
+ * 1. 그룹마다 프록시를 움직이고 승격 거리 안의 프록시를 모음
+ * 2. 모은 프록시를 MaxPromotionsPerFrame 개까지 액터로 승격 (나머지는 다음 프레임)
+ * 3. DemoteCheckInterval 마다 먼 순찰 적을 강등
+ */
+void UPatrolCrowdSubsystem::Tick(float DeltaTime)
+{
+	const APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	const FVector PlayerLocation = PlayerPawn ? PlayerPawn->GetActorLocation() : FVector::ZeroVector;
+
+	PendingPromotions.Reset();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PatrolCrowdUpdate);
+		for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+		{
+			UpdateGroup(GroupIndex, DeltaTime, PlayerLocation, PlayerPawn != nullptr);
+		}
+	}
+
+	int32 NumPromoted = 0;
+	int32 NumDemoted = 0;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_PatrolCrowdSwap);
+
+		/* 뒤쪽 인덱스부터 지워야 앞쪽 인덱스가 그대로 */
+		if (PendingPromotions.Num() > MaxPromotionsPerFrame)
+		{
+			PendingPromotions.SetNum(FMath::Max(MaxPromotionsPerFrame, 0), EAllowShrinking::No);
+		}
+		PendingPromotions.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B)
+		{
+			return A.Key != B.Key ? A.Key > B.Key : A.Value > B.Value;
+		});
+		for (const TPair<int32, int32>& Promotion : PendingPromotions)
+		{
+			PromoteProxy(Groups[Promotion.Key], Promotion.Value);
+			++NumPromoted;
+		}
+
+		TimeSinceDemoteCheck += DeltaTime;
+		if (PlayerPawn && TimeSinceDemoteCheck >= DemoteCheckInterval)
+		{
+			TimeSinceDemoteCheck = 0.f;
+			const int32 NumProxiesBefore = NumProxies;
+			DemoteDistantEnemies(PlayerLocation);
+			NumDemoted = NumProxies - NumProxiesBefore;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_PatrolCrowdProxies, NumProxies);
+	SET_DWORD_STAT(STAT_PatrolCrowdPromotions, NumPromoted);
+	SET_DWORD_STAT(STAT_PatrolCrowdDemotions, NumDemoted);
+}
+
+TStatId UPatrolCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPatrolCrowdSubsystem, STATGROUP_Tickables);
+}
+
+void UPatrolCrowdSubsystem::RegisterEnemy(AEnemy* Enemy)
+{
+	if (Enemy == nullptr || Enemy->GetCrowdProxyMesh() == nullptr) return;
+	Enemies.AddUnique(Enemy);
+}
+
+void UPatrolCrowdSubsystem::UnregisterEnemy(AEnemy* Enemy)
+{
+	Enemies.RemoveSwap(Enemy, EAllowShrinking::No);
+}
+
+/**
+ * 대기 중인 프록시는 시간만 줄이고, 걷는 프록시는 목표 점을 향해 직선으로 이동합니다.
+ * 멀리 있는 적만 프록시가 되므로 내비메시 대신 구운 구간 경로 점을 잇는 직선을 따라갑니다.
+ * 그래프에 다음 구간이 없을 때만 순찰 지점으로 바로 걸어가므로 승격할 때 위치를 내비메시에 투영합니다.
+ */
+void UPatrolCrowdSubsystem::UpdateGroup(int32 GroupIndex, float DeltaTime, const FVector& PlayerLocation, bool bHasPlayer)
+{
+	FPatrolCrowdGroup& Group = Groups[GroupIndex];
+	const int32 NumGroupProxies = Group.Locations.Num();
+	if (NumGroupProxies == 0 || Group.Instances == nullptr) return;
+
+	Group.InstanceTransforms.SetNum(NumGroupProxies, EAllowShrinking::No);
+
+	for (int32 Index = 0; Index < NumGroupProxies; ++Index)
+	{
+		FVector& Location = Group.Locations[Index];
+		FPatrolCrowdProxyState& State = Group.States[Index];
+		float& WaitTime = Group.WaitTimes[Index];
+
+		if (WaitTime > 0.f)
+		{
+			WaitTime -= DeltaTime;
+			if (WaitTime <= 0.f)
+			{
+				WaitTime = 0.f;
+				Group.Goals[Index] = GetFirstGoal(State, Location);
+				Group.Instances->SetCustomDataValue(Index, 0, 1.f, false);
+			}
+		}
+		else
+		{
+			const FVector ToGoal = Group.Goals[Index] - Location;
+			const double Distance = ToGoal.Size();
+			const double Step = State.Speed * DeltaTime;
+			if (Distance > Step)
+			{
+				Location += ToGoal * (Step / Distance);
+				Group.Yaws[Index] = FMath::RadiansToDegrees(FMath::Atan2(ToGoal.Y, ToGoal.X));
+			}
+			else
+			{
+				Location = Group.Goals[Index];
+				if (!AdvanceLegGoal(State, Group.Goals[Index]))
+				{
+					ChooseNextPatrolTarget(State, WaitTime);
+					Group.Instances->SetCustomDataValue(Index, 0, 0.f, false);
+				}
+			}
+		}
+
+		if (bHasPlayer && FVector::DistSquared(Location, PlayerLocation) <= State.PromoteRadiusSquared)
+		{
+			PendingPromotions.Emplace(GroupIndex, Index);
+		}
+
+		const FTransform ProxyTransform(FRotator(0.f, Group.Yaws[Index], 0.f), Location);
+		Group.InstanceTransforms[Index] = Group.MeshOffset * ProxyTransform;
+	}
+
+	Group.Instances->BatchUpdateInstancesTransforms(0, Group.InstanceTransforms, true, true, true);
+}
+
+void UPatrolCrowdSubsystem::ChooseNextPatrolTarget(FPatrolCrowdProxyState& State, float& OutWaitTime) const
+{
+	const int32 NextLeg = State.PatrolRoute ? State.PatrolRoute->ChooseNextLeg(State.PatrolWaypointIndex) : INDEX_NONE;
+	if (NextLeg != INDEX_NONE)
+	{
+		State.PatrolLegIndex = NextLeg;
+		State.PatrolWaypointIndex = State.PatrolRoute->GetLeg(NextLeg).To;
+		State.PatrolTarget = State.PatrolRoute->GetWaypoint(State.PatrolWaypointIndex);
+	}
+	else
+	{
+		/* 현재 지점을 제외한 후보 중 하나를 고름 (후보 수를 센 뒤 다시 훑어 할당 없이) */
+		State.PatrolLegIndex = INDEX_NONE;
+		int32 NumCandidates = 0;
+		for (const AActor* Target : State.PatrolTargets)
+		{
+			if (Target && Target != State.PatrolTarget) ++NumCandidates;
+		}
+		if (NumCandidates > 0)
+		{
+			int32 Pick = FMath::RandRange(0, NumCandidates - 1);
+			for (AActor* Target : State.PatrolTargets)
+			{
+				if (Target == nullptr || Target == State.PatrolTarget) continue;
+				if (Pick-- == 0)
+				{
+					State.PatrolTarget = Target;
+					break;
+				}
+			}
+		}
+		/* AEnemy::ResolvePatrolWaypoint 와 같이 다음 도착 때 쓸 그래프 지점을 다시 찾음 */
+		State.PatrolWaypointIndex = State.PatrolRoute ? State.PatrolRoute->FindWaypointIndex(State.PatrolTarget) : INDEX_NONE;
+	}
+	State.LegPointIndex = INDEX_NONE;
+
+	/* 대기 시간이 0 이어도 한 프레임은 대기 상태를 거쳐 다음 목표를 잡음 */
+	OutWaitTime = FMath::Max(FMath::RandRange(State.PatrolWaitMin, State.PatrolWaitMax), UE_KINDA_SMALL_NUMBER);
+}
+
+FVector UPatrolCrowdSubsystem::GetFirstGoal(FPatrolCrowdProxyState& State, const FVector& Location) const
+{
+	if (State.PatrolRoute && State.PatrolRoute->IsValidLeg(State.PatrolLegIndex))
+	{
+		const TArray<FVector>& PathPoints = State.PatrolRoute->GetLeg(State.PatrolLegIndex).PathPoints;
+		if (PathPoints.Num() > 1)
+		{
+			State.LegPointIndex = 1;
+			return PathPoints[1];
+		}
+	}
+	State.LegPointIndex = INDEX_NONE;
+	return State.PatrolTarget ? State.PatrolTarget->GetActorLocation() : Location;
+}
+
+bool UPatrolCrowdSubsystem::AdvanceLegGoal(FPatrolCrowdProxyState& State, FVector& OutGoal) const
+{
+	if (State.LegPointIndex == INDEX_NONE || State.PatrolRoute == nullptr || !State.PatrolRoute->IsValidLeg(State.PatrolLegIndex)) return false;
+
+	const TArray<FVector>& PathPoints = State.PatrolRoute->GetLeg(State.PatrolLegIndex).PathPoints;
+	if (++State.LegPointIndex >= PathPoints.Num()) return false;
+
+	OutGoal = PathPoints[State.LegPointIndex];
+	return true;
+}
+
+/**
+ * 순찰 중이고 보이는(풀에 들어가 있지 않은) 적 중 승격 거리 + DemoteHysteresis 밖의 적을 강등합니다.
+ * 강등 도중 풀 반환으로 UnregisterEnemy 가 불리므로 먼저 모은 뒤 처리합니다.
+ */
+void UPatrolCrowdSubsystem::DemoteDistantEnemies(const FVector& PlayerLocation)
+{
+	PendingDemotions.Reset();
+	for (AEnemy* Enemy : Enemies)
+	{
+		if (!IsValid(Enemy) || Enemy->IsHidden() || Enemy->GetEnemyState() != EEnemyState::EES_Patrolling) continue;
+
+		/* 구운 경로가 없으면 프록시가 벽을 뚫고 직선으로 걸으므로 액터로 남겨 둠 */
+		if (Enemy->GetPatrolRoute() == nullptr) continue;
+
+		const double DemoteRadius = Enemy->GetDetectionRadius() + PromoteMargin + DemoteHysteresis;
+		if (FVector::DistSquared(Enemy->GetActorLocation(), PlayerLocation) > DemoteRadius * DemoteRadius)
+		{
+			PendingDemotions.Add(Enemy);
+			if (PendingDemotions.Num() >= MaxDemotionsPerCheck) break;
+		}
+	}
+
+	for (AEnemy* Enemy : PendingDemotions)
+	{
+		DemoteEnemy(Enemy);
+	}
+	PendingDemotions.Reset();
+}
+
+/**
+ * 적의 순찰 상태(목표, 그래프 구간, 남은 대기 시간)와 체력을 프록시에 옮기고 적은 풀로 돌려보냅니다.
+ */
+void UPatrolCrowdSubsystem::DemoteEnemy(AEnemy* Enemy)
+{
+	FPatrolCrowdGroup* Group = FindOrAddGroup(Enemy);
+	if (Group == nullptr) return;
+
+	FPatrolCrowdProxyState State;
+	const float WaitTime = Enemy->GetPatrolState(State);
+	const double PromoteRadius = Enemy->GetDetectionRadius() + PromoteMargin;
+	State.PromoteRadiusSquared = PromoteRadius * PromoteRadius;
+
+	const FVector Location = Enemy->GetActorLocation() - FVector(0.f, 0.f, Group->CapsuleHalfHeight);
+	const float Yaw = Enemy->GetActorRotation().Yaw;
+
+	/* 대기 중이면 남은 시간만큼 기다린 뒤 (이미 골라 둔) 다음 지점으로, 이동 중이면 가장 가까운 다음 경로 점부터 */
+	FVector Goal = Location;
+	if (WaitTime <= 0.f)
+	{
+		Goal = GetFirstGoal(State, Location);
+		if (State.LegPointIndex != INDEX_NONE)
+		{
+			const TArray<FVector>& PathPoints = State.PatrolRoute->GetLeg(State.PatrolLegIndex).PathPoints;
+			int32 Closest = 0;
+			for (int32 PointIndex = 1; PointIndex < PathPoints.Num(); ++PointIndex)
+			{
+				if (FVector::DistSquared(PathPoints[PointIndex], Location) < FVector::DistSquared(PathPoints[Closest], Location))
+				{
+					Closest = PointIndex;
+				}
+			}
+			State.LegPointIndex = FMath::Min(Closest + 1, PathPoints.Num() - 1);
+			Goal = PathPoints[State.LegPointIndex];
+		}
+	}
+
+	const int32 InstanceIndex = Group->Instances->AddInstance(Group->MeshOffset * FTransform(FRotator(0.f, Yaw, 0.f), Location), true);
+	check(InstanceIndex == Group->Locations.Num());
+	Group->Instances->SetCustomDataValue(InstanceIndex, 0, WaitTime > 0.f ? 0.f : 1.f, true);
+	Group->Locations.Add(Location);
+	Group->Goals.Add(Goal);
+	Group->Yaws.Add(Yaw);
+	Group->WaitTimes.Add(WaitTime);
+	Group->States.Add(MoveTemp(State));
+	++NumProxies;
+
+	if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+	{
+		Pool->Release(Enemy);
+	}
+	else
+	{
+		Enemy->Destroy();
+	}
+}
+
+/**
+ * 풀에서 적을 꺼내(없으면 생성) 프록시의 순찰 상태와 체력을 되돌립니다.
+ * 대기 중이던 프록시는 남은 시간 뒤 순찰 타이머로, 걷던 프록시는 바로 순찰 지점으로 이동합니다.
+ * 프록시 위치가 내비메시를 벗어났을 수 있으므로 내비메시 위의 가장 가까운 점에 꺼냅니다.
+ */
+void UPatrolCrowdSubsystem::PromoteProxy(FPatrolCrowdGroup& Group, int32 Index)
+{
+	const FPatrolCrowdProxyState State = Group.States[Index];
+	const float WaitTime = Group.WaitTimes[Index];
+
+	FVector Location = Group.Locations[Index];
+	if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		FNavLocation NavLocation;
+		if (NavSys->ProjectPointToNavigation(Location, NavLocation))
+		{
+			Location = NavLocation.Location;
+		}
+	}
+	const FTransform SpawnTransform(FRotator(0.f, Group.Yaws[Index], 0.f), Location + FVector(0.f, 0.f, Group.CapsuleHalfHeight));
+
+	Group.Instances->RemoveInstance(Index);
+	Group.Locations.RemoveAt(Index, EAllowShrinking::No);
+	Group.Goals.RemoveAt(Index, EAllowShrinking::No);
+	Group.Yaws.RemoveAt(Index, EAllowShrinking::No);
+	Group.WaitTimes.RemoveAt(Index, EAllowShrinking::No);
+	Group.States.RemoveAt(Index, EAllowShrinking::No);
+	--NumProxies;
+
+	AEnemy* Enemy = nullptr;
+	if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+	{
+		Enemy = Pool->Acquire<AEnemy>(Group.EnemyClass, SpawnTransform);
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		Enemy = GetWorld()->SpawnActor<AEnemy>(Group.EnemyClass, SpawnTransform, SpawnParameters);
+	}
+	if (Enemy)
+	{
+		Enemy->ApplyPatrolState(State, WaitTime);
+	}
+}
+
+/**
+ * 적 클래스의 그룹을 찾고, 없으면 인스턴스 메시 컴포넌트와 함께 만듭니다.
+ * 프록시 메시 위치는 적 스켈레탈 메시의 상대 변환을 따르므로 같은 원점/방향으로 구운 메시를 쓰면 됩니다.
+ */
+FPatrolCrowdGroup* UPatrolCrowdSubsystem::FindOrAddGroup(AEnemy* Enemy)
+{
+	UClass* EnemyClass = Enemy->GetClass();
+	for (FPatrolCrowdGroup& Group : Groups)
+	{
+		if (Group.EnemyClass == EnemyClass) return &Group;
+	}
+
+	UWorld* World = GetWorld();
+	if (ProxyRenderer == nullptr)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		ProxyRenderer = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+		if (ProxyRenderer == nullptr) return nullptr;
+	}
+
+	UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(ProxyRenderer);
+	Instances->SetMobility(EComponentMobility::Movable);
+	Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Instances->SetCanEverAffectNavigation(false);
+	Instances->SetStaticMesh(Enemy->GetCrowdProxyMesh());
+	Instances->NumCustomDataFloats = 1;
+	if (ProxyRenderer->GetRootComponent() == nullptr)
+	{
+		ProxyRenderer->SetRootComponent(Instances);
+	}
+	Instances->RegisterComponent();
+	ProxyRenderer->AddInstanceComponent(Instances);
+
+	FPatrolCrowdGroup& Group = Groups.AddDefaulted_GetRef();
+	Group.EnemyClass = EnemyClass;
+	Group.Instances = Instances;
+	Group.CapsuleHalfHeight = Enemy->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	Group.MeshOffset = Enemy->GetMesh()->GetRelativeTransform();
+	Group.MeshOffset.AddToTranslation(FVector(0.f, 0.f, Group.CapsuleHalfHeight));
+	return &Group;
+}
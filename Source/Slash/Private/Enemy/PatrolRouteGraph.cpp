@@ -0,0 +1,160 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/PatrolRouteGraph.h"
+#include "Enemy/Enemy.h"
+#include "EngineUtils.h"
+#include "NavigationSystem.h"
+#include "NavigationPath.h"
+#include "NavigationData.h"
+
+APatrolRouteGraph::APatrolRouteGraph()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void APatrolRouteGraph::BeginPlay()
+{
+	Super::BeginPlay();
+	RebuildNodes();
+
+	LegPaths.SetNum(Legs.Num());
+	for (int32 LegIndex = 0; LegIndex < Legs.Num(); ++LegIndex)
+	{
+		const TArray<FVector>& PathPoints = Legs[LegIndex].PathPoints;
+		if (PathPoints.Num() > 1)
+		{
+			LegPaths[LegIndex] = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(PathPoints);
+		}
+	}
+}
+
+#if WITH_EDITOR
+void APatrolRouteGraph::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	RebuildNodes();
+}
+#endif
+
+void APatrolRouteGraph::BuildFromEnemies()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return;
+
+	Modify();
+	Waypoints.Reset();
+	Legs.Reset();
+
+	TSet<TPair<int32, int32>> Connected;
+	for (TActorIterator<AEnemy> It(World); It; ++It)
+	{
+		AEnemy* Enemy = *It;
+		if (Enemy->GetPatrolRoute() != this) continue;
+
+		const TArray<AActor*>& PatrolTargets = Enemy->GetPatrolTargets();
+		for (AActor* From : PatrolTargets)
+		{
+			if (From == nullptr) continue;
+			const int32 FromIndex = Waypoints.AddUnique(From);
+
+			for (AActor* To : PatrolTargets)
+			{
+				if (To == nullptr || To == From) continue;
+				const int32 ToIndex = Waypoints.AddUnique(To);
+
+				bool bAlreadyConnected = false;
+				Connected.Add(TPair<int32, int32>(FromIndex, ToIndex), &bAlreadyConnected);
+				if (bAlreadyConnected) continue;
+
+				FPatrolRouteLeg& Leg = Legs.AddDefaulted_GetRef();
+				Leg.From = FromIndex;
+				Leg.To = ToIndex;
+			}
+		}
+	}
+
+	RebuildNodes();
+	BakePaths();
+}
+
+void APatrolRouteGraph::BakePaths()
+{
+	UWorld* World = GetWorld();
+	if (World == nullptr) return;
+
+	Modify();
+	int32 NumFailed = 0;
+	for (FPatrolRouteLeg& Leg : Legs)
+	{
+		Leg.PathPoints.Reset();
+		const AActor* From = GetWaypoint(Leg.From);
+		const AActor* To = GetWaypoint(Leg.To);
+		if (From == nullptr || To == nullptr) continue;
+
+		const UNavigationPath* Path = UNavigationSystemV1::FindPathToLocationSynchronously(World, From->GetActorLocation(), To->GetActorLocation());
+		if (Path && Path->IsValid() && Path->PathPoints.Num() > 1)
+		{
+			Leg.PathPoints = Path->PathPoints;
+		}
+		else
+		{
+			++NumFailed;
+		}
+	}
+
+	if (NumFailed > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: %d of %d patrol legs have no navmesh path, they will pathfind at runtime"), *GetName(), NumFailed, Legs.Num());
+	}
+}
+
+int32 APatrolRouteGraph::FindWaypointIndex(const AActor* Waypoint) const
+{
+	return Waypoint ? Waypoints.IndexOfByKey(Waypoint) : INDEX_NONE;
+}
+
+int32 APatrolRouteGraph::ChooseNextLeg(int32 FromWaypoint) const
+{
+	if (!Nodes.IsValidIndex(FromWaypoint)) return INDEX_NONE;
+
+	const FPatrolRouteNode& Node = Nodes[FromWaypoint];
+	if (Node.NumLegs == 0) return INDEX_NONE;
+	if (Node.TotalWeight <= 0.f) return Node.FirstLeg + FMath::RandRange(0, Node.NumLegs - 1);
+
+	float Pick = FMath::FRand() * Node.TotalWeight;
+	const int32 LastLeg = Node.FirstLeg + Node.NumLegs - 1;
+	for (int32 LegIndex = Node.FirstLeg; LegIndex < LastLeg; ++LegIndex)
+	{
+		Pick -= Legs[LegIndex].Weight;
+		if (Pick < 0.f) return LegIndex;
+	}
+	return LastLeg;
+}
+
+FNavPathSharedPtr APatrolRouteGraph::GetLegPath(int32 LegIndex) const
+{
+	return LegPaths.IsValidIndex(LegIndex) ? LegPaths[LegIndex] : nullptr;
+}
+
+void APatrolRouteGraph::RebuildNodes()
+{
+	Legs.StableSort([](const FPatrolRouteLeg& A, const FPatrolRouteLeg& B) { return A.From < B.From; });
+
+	Nodes.Reset();
+	Nodes.SetNum(Waypoints.Num());
+	for (int32 LegIndex = 0; LegIndex < Legs.Num(); ++LegIndex)
+	{
+		const FPatrolRouteLeg& Leg = Legs[LegIndex];
+		if (!Nodes.IsValidIndex(Leg.From)) continue;
+
+		FPatrolRouteNode& Node = Nodes[Leg.From];
+		if (Node.NumLegs == 0)
+		{
+			Node.FirstLeg = LegIndex;
+		}
+		++Node.NumLegs;
+		Node.TotalWeight += FMath::Max(Leg.Weight, 0.f);
+	}
+}
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Enemy/SightQueryComponent.h"
+#include "Enemy/EnemyPerceptionSubsystem.h"
+
+USightQueryComponent::USightQueryComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	PeripheralVisionCosine = FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle));
+}
+
+void USightQueryComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	PeripheralVisionCosine = FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle));
+	SetSensingEnabled(true);
+}
+
+void USightQueryComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	SetSensingEnabled(false);
+	Super::EndPlay(EndPlayReason);
+}
+
+void USightQueryComponent::SetSensingEnabled(bool bEnabled)
+{
+	UEnemyPerceptionSubsystem* Perception = GetWorld()->GetSubsystem<UEnemyPerceptionSubsystem>();
+	if (Perception == nullptr) return;
+
+	if (bEnabled)
+	{
+		Perception->RegisterSensor(this);
+	}
+	else
+	{
+		Perception->UnregisterSensor(this);
+	}
+}
+
+void USightQueryComponent::SetPeripheralVisionAngle(float NewPeripheralVisionAngle)
+{
+	PeripheralVisionAngle = NewPeripheralVisionAngle;
+	PeripheralVisionCosine = FMath::Cos(FMath::DegreesToRadians(PeripheralVisionAngle));
+}
+
+FVector USightQueryComponent::GetSensorLocation() const
+{
+	FVector EyeLocation = FVector::ZeroVector;
+	if (const AActor* Owner = GetOwner())
+	{
+		FRotator EyeRotation;
+		Owner->GetActorEyesViewPoint(EyeLocation, EyeRotation);
+	}
+	return EyeLocation;
+}
+
+FVector USightQueryComponent::GetSensorDirection() const
+{
+	const AActor* Owner = GetOwner();
+	return Owner ? Owner->GetActorForwardVector() : FVector::ForwardVector;
+}
+
+void USightQueryComponent::NotifySeePawn(APawn* SeenPawn)
+{
+	OnSeePawn.Broadcast(SeenPawn);
+}
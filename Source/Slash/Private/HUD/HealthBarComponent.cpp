@@ -2,18 +2,49 @@
 
 
 #include "HUD/HealthBarComponent.h"
-#include "Components/ProgressBar.h"
-#include "HUD/HealthBar.h"
+#include "HUD/HealthBarSubsystem.h"
 
-void UHealthBarComponent::SetHealthBarPercent(float Percent)
+UHealthBarComponent::UHealthBarComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UHealthBarComponent::BeginPlay()
 {
-	if (HealthBarWidget == nullptr)
+	Super::BeginPlay();
+
+	if (UHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UHealthBarSubsystem>())
 	{
-		HealthBarWidget = Cast<UHealthBar>(GetUserWidgetObject());
+		HealthBars->RegisterBar(this, HealthPercent, GetVisibleFlag());
 	}
-	
-	if (HealthBarWidget && HealthBarWidget->HealthBar)
+}
+
+void UHealthBarComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UHealthBarSubsystem>())
+	{
+		HealthBars->UnregisterBar(this);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void UHealthBarComponent::OnVisibilityChanged()
+{
+	Super::OnVisibilityChanged();
+
+	UWorld* World = GetWorld();
+	if (UHealthBarSubsystem* HealthBars = World ? World->GetSubsystem<UHealthBarSubsystem>() : nullptr)
+	{
+		HealthBars->SetBarVisible(this, GetVisibleFlag());
+	}
+}
+
+void UHealthBarComponent::SetHealthBarPercent(float Percent)
+{
+	HealthPercent = Percent;
+
+	if (UHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UHealthBarSubsystem>())
 	{
-		HealthBarWidget->HealthBar->SetPercent(Percent);
+		HealthBars->SetBarPercent(this, Percent);
 	}
-}
\ No newline at end of file
+}
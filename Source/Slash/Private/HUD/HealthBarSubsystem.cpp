@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "HUD/HealthBarSubsystem.h"
+#include "HUD/HealthBarComponent.h"
+
+void UHealthBarSubsystem::Deinitialize()
+{
+	for (const FHealthBarEntry& Entry : Entries)
+	{
+		if (Entry.Component)
+		{
+			Entry.Component->BarIndex = INDEX_NONE;
+		}
+	}
+	Entries.Empty();
+	NumVisible = 0;
+	Super::Deinitialize();
+}
+
+bool UHealthBarSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHealthBarSubsystem::RegisterBar(UHealthBarComponent* Component, float HealthPercent, bool bVisible)
+{
+	if (Component == nullptr || Component->BarIndex != INDEX_NONE) return;
+
+	FHealthBarEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Component = Component;
+	Entry.HealthPercent = HealthPercent;
+	Component->BarIndex = Entries.Num() - 1;
+
+	if (bVisible)
+	{
+		SetBarVisible(Component, true);
+	}
+}
+
+void UHealthBarSubsystem::UnregisterBar(UHealthBarComponent* Component)
+{
+	if (Component == nullptr || !Entries.IsValidIndex(Component->BarIndex)) return;
+
+	// 보이는 구간에서 먼저 빼낸 뒤 마지막 자리로 보내 제거
+	SetBarVisible(Component, false);
+	SwapEntries(Component->BarIndex, Entries.Num() - 1);
+	Entries.Pop(EAllowShrinking::No);
+	Component->BarIndex = INDEX_NONE;
+}
+
+void UHealthBarSubsystem::SetBarPercent(const UHealthBarComponent* Component, float HealthPercent)
+{
+	if (Component && Entries.IsValidIndex(Component->BarIndex))
+	{
+		Entries[Component->BarIndex].HealthPercent = HealthPercent;
+	}
+}
+
+/**
+ * 보이게 되면 보이는 구간 끝으로, 숨겨지면 보이는 구간 밖으로 자리를 바꿉니다.
+ */
+void UHealthBarSubsystem::SetBarVisible(UHealthBarComponent* Component, bool bVisible)
+{
+	if (Component == nullptr || !Entries.IsValidIndex(Component->BarIndex)) return;
+
+	const bool bCurrentlyVisible = Component->BarIndex < NumVisible;
+	if (bVisible == bCurrentlyVisible) return;
+
+	if (bVisible)
+	{
+		SwapEntries(Component->BarIndex, NumVisible);
+		++NumVisible;
+	}
+	else
+	{
+		--NumVisible;
+		SwapEntries(Component->BarIndex, NumVisible);
+	}
+}
+
+void UHealthBarSubsystem::SwapEntries(int32 First, int32 Second)
+{
+	if (First == Second) return;
+
+	Entries.Swap(First, Second);
+	Entries[First].Component->BarIndex = First;
+	Entries[Second].Component->BarIndex = Second;
+}
@@ -3,6 +3,13 @@
 
 #include "HUD/SlashHUD.h"
 #include "HUD/SlashOverlay.h"
+#include "HUD/HealthBarSubsystem.h"
+#include "HUD/HealthBarComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Enemy Health Bars Draw"), STAT_EnemyHealthBarsDraw, STATGROUP_SlashCombat);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Enemy Health Bars Drawn"), STAT_EnemyHealthBarsDrawn, STATGROUP_SlashCombat);
 
 void ASlashHUD::BeginPlay()
 {
@@ -19,3 +26,45 @@ void ASlashHUD::BeginPlay()
 		}
 	}
 }
+
+void ASlashHUD::DrawHUD()
+{
+	Super::DrawHUD();
+	DrawEnemyHealthBars();
+}
+
+/**
+ * 체력바마다 월드 위치를 화면으로 투영해 배경/채움 사각형 두 개를 그립니다.
+ * 카메라 뒤쪽이나 HealthBarMaxDrawDistance 밖의 체력바는 건너뜁니다.
+ */
+void ASlashHUD::DrawEnemyHealthBars()
+{
+	SCOPE_CYCLE_COUNTER(STAT_EnemyHealthBarsDraw);
+
+	const UHealthBarSubsystem* HealthBars = GetWorld()->GetSubsystem<UHealthBarSubsystem>();
+	if (HealthBars == nullptr || Canvas == nullptr || PlayerOwner == nullptr) return;
+
+	FVector CameraLocation;
+	FRotator CameraRotation;
+	PlayerOwner->GetPlayerViewPoint(CameraLocation, CameraRotation);
+	const FVector CameraForward = CameraRotation.Vector();
+	const float MaxDistanceSquared = FMath::Square(HealthBarMaxDrawDistance);
+	const FVector2D HalfSize = HealthBarSize * 0.5f;
+
+	int32 NumDrawn = 0;
+	for (const FHealthBarEntry& Entry : HealthBars->GetVisibleBars())
+	{
+		const FVector WorldLocation = Entry.Component->GetComponentLocation();
+		const FVector ToBar = WorldLocation - CameraLocation;
+		if ((ToBar | CameraForward) <= 0.f || ToBar.SizeSquared() > MaxDistanceSquared) continue;
+		if (Entry.Component->GetOwner()->IsHidden()) continue;
+
+		const FVector ScreenLocation = Project(WorldLocation);
+		const float Left = ScreenLocation.X - HalfSize.X;
+		const float Top = ScreenLocation.Y - HalfSize.Y;
+		DrawRect(HealthBarBackgroundColor, Left, Top, HealthBarSize.X, HealthBarSize.Y);
+		DrawRect(HealthBarFillColor, Left, Top, HealthBarSize.X * FMath::Clamp(Entry.HealthPercent, 0.f, 1.f), HealthBarSize.Y);
+		++NumDrawn;
+	}
+	SET_DWORD_STAT(STAT_EnemyHealthBarsDrawn, NumDrawn);
+}
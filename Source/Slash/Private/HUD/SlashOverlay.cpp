@@ -4,39 +4,86 @@
 #include "HUD/SlashOverlay.h"
 #include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
+#include "Components/AttributeComponent.h"
 
-void USlashOverlay::SetHealthBarPercent(float Percent)
+namespace SlashOverlayFormat
 {
-	if (HealthProgressBar)
+	/* 골드/영혼 표기: 정수, 천 단위 구분 없음 (기존 "%d" 와 같은 결과) */
+	static const FNumberFormattingOptions& GetCountFormat()
 	{
-		HealthProgressBar->SetPercent(Percent);
+		static const FNumberFormattingOptions Options = FNumberFormattingOptions().SetUseGrouping(false);
+		return Options;
 	}
 }
 
-void USlashOverlay::SetStaminaBarPercent(float Percent)
+void USlashOverlay::BindAttributes(UAttributeComponent* Attribute)
 {
-	if (StaminaProgressBar)
+	if (UAttributeComponent* Previous = BoundAttribute.Get())
 	{
-		StaminaProgressBar->SetPercent(Percent);
+		Previous->OnAttributeChanged.Remove(AttributeChangedHandle);
 	}
+	AttributeChangedHandle.Reset();
+	BoundAttribute = Attribute;
+	if (Attribute == nullptr) return;
+
+	AttributeChangedHandle = Attribute->OnAttributeChanged.AddUObject(this, &USlashOverlay::OnAttributeChanged);
+	Model.SetHealthPercent(Attribute->GetHealthPercent());
+	Model.SetStaminaPercent(Attribute->GetStaminaPercent());
+	Model.SetGold(Attribute->GetGold());
+	Model.SetSouls(Attribute->GetSouls());
+}
+
+void USlashOverlay::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+	if (Model.DirtyFlags != FSlashHUDModel::DF_None)
+	{
+		FlushModel();
+	}
+}
+
+void USlashOverlay::NativeDestruct()
+{
+	BindAttributes(nullptr);
+	Super::NativeDestruct();
 }
 
-void USlashOverlay::SetGold(int32 Gold)
+void USlashOverlay::OnAttributeChanged(UAttributeComponent* Attribute, EAttributeType Type)
 {
-	if (GoldText)
+	switch (Type)
 	{
-		const FString String = FString::Printf(TEXT("%d"), Gold);
-		const FText Text = FText::FromString(String);
-		GoldText->SetText(Text);
+	case EAttributeType::EAT_Health:
+		Model.SetHealthPercent(Attribute->GetHealthPercent());
+		break;
+	case EAttributeType::EAT_Stamina:
+		Model.SetStaminaPercent(Attribute->GetStaminaPercent());
+		break;
+	case EAttributeType::EAT_Gold:
+		Model.SetGold(Attribute->GetGold());
+		break;
+	case EAttributeType::EAT_Souls:
+		Model.SetSouls(Attribute->GetSouls());
+		break;
 	}
 }
 
-void USlashOverlay::SetSouls(int32 Souls)
+void USlashOverlay::FlushModel()
 {
-	if (SoulsText)
+	if (Model.IsDirty(FSlashHUDModel::DF_Health) && HealthProgressBar)
+	{
+		HealthProgressBar->SetPercent(Model.HealthPercent);
+	}
+	if (Model.IsDirty(FSlashHUDModel::DF_Stamina) && StaminaProgressBar)
+	{
+		StaminaProgressBar->SetPercent(Model.StaminaPercent);
+	}
+	if (Model.IsDirty(FSlashHUDModel::DF_Gold) && GoldText)
+	{
+		GoldText->SetText(FText::AsNumber(Model.Gold, &SlashOverlayFormat::GetCountFormat()));
+	}
+	if (Model.IsDirty(FSlashHUDModel::DF_Souls) && SoulsText)
 	{
-		const FString String = FString::Printf(TEXT("%d"), Souls);
-		const FText Text = FText::FromString(String);
-		SoulsText->SetText(Text);
+		SoulsText->SetText(FText::AsNumber(Model.Souls, &SlashOverlayFormat::GetCountFormat()));
 	}
-}
\ No newline at end of file
+	Model.ClearDirty();
+}
@@ -0,0 +1,13 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Interface/PoolableInterface.h"
+
+// Add default functionality here for any IPoolableInterface functions that are not pure virtual.
+void IPoolableInterface::Activate()
+{
+}
+
+void IPoolableInterface::Deactivate()
+{
+}
@@ -13,6 +13,6 @@ void AHealPotion::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AAct
 		PickupInterface->AddHealth(this);
 		SpawnPickupSystem();
 		SpawnPickupSound();
-		Destroy();
+		ReturnToPool();
 	}
 }
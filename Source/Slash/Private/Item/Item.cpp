@@ -6,10 +6,15 @@
 #include "Interface/PickupInterface.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Combat/CombatSpatialHash.h"
+#include "Pool/ActorPoolSubsystem.h"
+#include "Item/ItemHoverSubsystem.h"
+#include "Combat/ImpactEffectSubsystem.h"
 
 AItem::AItem()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	/* 떠 있는 움직임은 UItemHoverSubsystem 이 일괄 처리하므로 액터 틱은 사용하지 않음 */
+	PrimaryActorTick.bCanEverTick = false;
 
 	ItemMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("ItemMeshComponent"));
 
@@ -22,8 +27,15 @@ AItem::AItem()
 	Sphere = CreateDefaultSubobject<USphereComponent>(TEXT("Sphere"));
 	Sphere->SetupAttachment(GetRootComponent());
 
+	/* 루트(ItemMesh)는 그대로 두고 이 메시만 움직이므로 트랜스폼 전파/겹침 갱신이 Sphere 까지 가지 않음 */
+	HoverMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("HoverMesh"));
+	HoverMesh->SetupAttachment(GetRootComponent());
+	HoverMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	HoverMesh->SetGenerateOverlapEvents(false);
+	HoverMesh->SetVisibility(false);
+
 	ItemEffect = CreateDefaultSubobject<UNiagaraComponent>(TEXT("Embers"));
-	ItemEffect->SetupAttachment(GetRootComponent());
+	ItemEffect->SetupAttachment(HoverMesh);
 }
 
 void AItem::BeginPlay()
@@ -33,18 +45,81 @@ void AItem::BeginPlay()
 	/* 콜백을 델리게이트에 바인딩 */
 	Sphere->OnComponentBeginOverlap.AddDynamic(this, &AItem::OnSphereOverlap);
 	Sphere->OnComponentEndOverlap.AddDynamic(this, &AItem::OnSphereEndOverlap);
+
+	/* 바닥에 놓인 아이템만 줍기 대상으로 등록 (장착되면 AWeapon::Equip 에서 해제) */
+	if (ItemState == EItemState::EIS_Hovering)
+	{
+		StartHovering();
+	}
+}
+
+void AItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopHovering();
+	Super::EndPlay(EndPlayReason);
 }
 
 float AItem::TransformedSin()
 {
+	const UItemHoverSubsystem* HoverSubsystem = GetWorld()->GetSubsystem<UItemHoverSubsystem>();
+	const float RunningTime = HoverSubsystem ? HoverSubsystem->GetRunningTime(this) : 0.f;
 	return Amplitude * FMath::Sin(RunningTime * TimeConstant);
 }
 
 float AItem::TransformedCos()
 {
+	const UItemHoverSubsystem* HoverSubsystem = GetWorld()->GetSubsystem<UItemHoverSubsystem>();
+	const float RunningTime = HoverSubsystem ? HoverSubsystem->GetRunningTime(this) : 0.f;
 	return Amplitude * FMath::Cos(RunningTime * TimeConstant);
 }
 
+void AItem::StartHovering()
+{
+	UWorld* World = GetWorld();
+	if (UCombatSpatialHash* SpatialHash = World->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->RegisterActor(this, ECombatActorType::ECAT_Pickup);
+	}
+	UItemHoverSubsystem* HoverSubsystem = World->GetSubsystem<UItemHoverSubsystem>();
+	if (HoverSubsystem && HoverIndex == INDEX_NONE)
+	{
+		/* 블루프린트가 ItemMesh 에 지정한 메시/머티리얼을 그대로 그림 */
+		HoverMesh->SetStaticMesh(ItemMesh->GetStaticMesh());
+		for (int32 Index = 0; Index < ItemMesh->GetNumMaterials(); ++Index)
+		{
+			HoverMesh->SetMaterial(Index, ItemMesh->GetMaterial(Index));
+		}
+		ApplyHoverOffset(0.f);
+		HoverMesh->SetVisibility(true);
+		ItemMesh->SetVisibility(false);
+
+		HoverSubsystem->RegisterItem(this);
+	}
+}
+
+void AItem::StopHovering()
+{
+	UWorld* World = GetWorld();
+	if (UCombatSpatialHash* SpatialHash = World->GetSubsystem<UCombatSpatialHash>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+	if (UItemHoverSubsystem* HoverSubsystem = World->GetSubsystem<UItemHoverSubsystem>())
+	{
+		HoverSubsystem->UnregisterItem(this);
+	}
+
+	/* 장착된 무기가 손에서 떠 보이지 않게 원래 메시로 되돌림 */
+	ApplyHoverOffset(0.f);
+	HoverMesh->SetVisibility(false);
+	ItemMesh->SetVisibility(true);
+}
+
+void AItem::ApplyHoverOffset(float Offset)
+{
+	HoverMesh->SetRelativeLocation(FVector(0.f, 0.f, Offset));
+}
+
 /*
  * 이 함수는 충돌 영역(Sphere Component)에 다른 액터가 겹쳤을 때 호출된다.
  * 아이템이 플레이어와 겹칠 때 실행되며, 겹친 액터(OtherActor)가 어떤 대상인지, 충돌 정보(SweepResult) 등을 확인하고 필요한 처리를 할 수 있다.
@@ -74,21 +149,54 @@ void AItem::OnSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor*
 	}
 }
 
-void AItem::Tick(float DeltaTime) 
+/**
+ * 풀에서 꺼내질 때 호출됩니다. 보이게 하고 충돌/이펙트와 떠 있는 움직임을 다시 켭니다.
+ */
+void AItem::Activate()
 {
-	Super::Tick(DeltaTime);
-
-	RunningTime += DeltaTime;
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	ItemEffect->Activate(true);
 
 	if (ItemState == EItemState::EIS_Hovering)
 	{
-		AddActorWorldOffset(FVector(0.f, 0.f, TransformedSin()));
+		StartHovering();
+	}
+}
+
+/**
+ * 풀로 돌아갈 때 호출됩니다. 숨기고 충돌/이펙트와 떠 있는 움직임을 끕니다.
+ */
+void AItem::Deactivate()
+{
+	StopHovering();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	ItemEffect->Deactivate();
+}
+
+void AItem::ReturnToPool()
+{
+	if (UActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UActorPoolSubsystem>())
+	{
+		Pool->Release(this);
+	}
+	else
+	{
+		Destroy();
 	}
 }
 
 void AItem::SpawnPickupSystem()
 {
-	if (PickupEffect)
+	if (PickupEffect == nullptr) return;
+
+	if (UImpactEffectSubsystem* ImpactEffects = GetWorld()->GetSubsystem<UImpactEffectSubsystem>())
+	{
+		ImpactEffects->QueueNiagara(PickupEffect, GetActorLocation());
+	}
+	else
 	{
 		UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, PickupEffect, GetActorLocation());
 	}
@@ -96,7 +204,13 @@ void AItem::SpawnPickupSystem()
 
 void AItem::SpawnPickupSound()
 {
-	if (PickupSound)
+	if (PickupSound == nullptr) return;
+
+	if (UImpactEffectSubsystem* ImpactEffects = GetWorld()->GetSubsystem<UImpactEffectSubsystem>())
+	{
+		ImpactEffects->QueueSound(PickupSound, GetActorLocation());
+	}
+	else
 	{
 		UGameplayStatics::SpawnSoundAtLocation(this, PickupSound, GetActorLocation());
 	}
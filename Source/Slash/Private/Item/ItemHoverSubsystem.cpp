@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Item/ItemHoverSubsystem.h"
+#include "Item/Item.h"
+#include "Slash/Slash.h"
+
+DECLARE_CYCLE_STAT(TEXT("Item Hover Update"), STAT_ItemHoverUpdate, STATGROUP_SlashItem);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hovering Items"), STAT_HoveringItems, STATGROUP_SlashItem);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hovering Items Updated"), STAT_HoveringItemsUpdated, STATGROUP_SlashItem);
+
+void UItemHoverSubsystem::Deinitialize()
+{
+	for (AItem* Item : Items)
+	{
+		if (Item)
+		{
+			Item->HoverIndex = INDEX_NONE;
+		}
+	}
+	Items.Empty();
+	RunningTimes.Empty();
+	Amplitudes.Empty();
+	TimeConstants.Empty();
+	Offsets.Empty();
+	Super::Deinitialize();
+}
+
+bool UItemHoverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UItemHoverSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ItemHoverUpdate);
+
+	// 1. 시간과 누적 오프셋 계산 (AItem::Tick 과 같은 식: 매 프레임 Amplitude * Sin(RunningTime * TimeConstant) 만큼 이동)
+	const int32 NumItems = Items.Num();
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		RunningTimes[Index] += DeltaTime;
+		Offsets[Index] += Amplitudes[Index] * FMath::Sin(RunningTimes[Index] * TimeConstants[Index]);
+	}
+
+	// 2. 보이는 아이템만 충돌 없는 HoverMesh 의 상대 위치 갱신 (루트/Sphere 트랜스폼과 겹침은 그대로)
+	int32 NumUpdated = 0;
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		AItem* Item = Items[Index];
+		if (Item == nullptr || !Item->WasRecentlyRendered(VisibleRenderTime)) continue;
+
+		Item->ApplyHoverOffset(Offsets[Index]);
+		++NumUpdated;
+	}
+
+	SET_DWORD_STAT(STAT_HoveringItems, NumItems);
+	SET_DWORD_STAT(STAT_HoveringItemsUpdated, NumUpdated);
+}
+
+TStatId UItemHoverSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemHoverSubsystem, STATGROUP_Tickables);
+}
+
+void UItemHoverSubsystem::RegisterItem(AItem* Item)
+{
+	if (Item == nullptr || Item->HoverIndex != INDEX_NONE) return;
+
+	Item->HoverIndex = Items.Add(Item);
+	RunningTimes.Add(0.f);
+	Amplitudes.Add(Item->Amplitude);
+	TimeConstants.Add(Item->TimeConstant);
+	Offsets.Add(0.f);
+}
+
+void UItemHoverSubsystem::UnregisterItem(AItem* Item)
+{
+	if (Item == nullptr || !Items.IsValidIndex(Item->HoverIndex) || Items[Item->HoverIndex] != Item) return;
+
+	RemoveAt(Item->HoverIndex);
+	Item->HoverIndex = INDEX_NONE;
+}
+
+float UItemHoverSubsystem::GetRunningTime(const AItem* Item) const
+{
+	if (Item == nullptr || !Items.IsValidIndex(Item->HoverIndex)) return 0.f;
+	return RunningTimes[Item->HoverIndex];
+}
+
+/**
+ * 마지막 원소를 빈 자리로 옮겨 배열을 연속으로 유지합니다.
+ */
+void UItemHoverSubsystem::RemoveAt(int32 Index)
+{
+	Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RunningTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Amplitudes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	TimeConstants.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Offsets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (Items.IsValidIndex(Index) && Items[Index])
+	{
+		Items[Index]->HoverIndex = Index;
+	}
+}
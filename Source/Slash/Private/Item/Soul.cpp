@@ -13,6 +13,6 @@ void ASoul::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* Ot
 		PickupInterface->AddSoul(this);
 		SpawnPickupSystem();
 		SpawnPickupSound();
-		Destroy();
+		ReturnToPool();
 	}
 }
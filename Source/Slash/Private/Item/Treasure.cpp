@@ -19,6 +19,6 @@ void ATreasure::OnSphereOverlap(
 	{
 		PickupInterface->AddGold(this);
 		SpawnPickupSound();
-		Destroy();
+		ReturnToPool();
 	}
 }
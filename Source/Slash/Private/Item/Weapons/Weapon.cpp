@@ -5,9 +5,11 @@
 #include "Kismet/GameplayStatics.h"
 #include "Components/SphereComponent.h"
 #include "Components/BoxComponent.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Interface/HitInterface.h"
 #include "NiagaraComponent.h"
+#include "Combat/WeaponTraceSubsystem.h"
+#include "Combat/DamageQueueSubsystem.h"
+#include "DrawDebugHelpers.h"
 
 AWeapon::AWeapon()
 {
@@ -29,13 +31,16 @@ void AWeapon::BeginPlay()
 	Super::BeginPlay();
 
 	WeaponBox->OnComponentBeginOverlap.AddDynamic(this, &AWeapon::OnBoxOverlap);
+	ResetBoxTraceParams();
 }
 
 void AWeapon::Equip(USceneComponent* InParent, FName InSocketName, AActor* NewOwner, APawn* NewInstigator)
 {
 	ItemState = EItemState::EIS_Equipped;
+	StopHovering();
 	SetOwner(NewOwner);
 	SetInstigator(NewInstigator);
+	ResetBoxTraceParams();
 	AttachMeshToSocket(InParent, InSocketName);
 	DisableSphereCollision();
 	PlayEquipSound();
@@ -80,29 +85,57 @@ void AWeapon::AttachMeshToSocket(USceneComponent* InParent, const FName& InSocke
 	ItemMesh->AttachToComponent(InParent, TransformRules, InSocketName);
 }
 
+/**
+ * 무기 박스에 무언가 겹치면 박스 트레이스를 예약합니다.
+ * 실제 트레이스와 데미지 처리는 UWeaponTraceSubsystem 이 다음 프레임에 일괄 처리합니다.
+ */
 void AWeapon::OnBoxOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (ActorIsSameType(OtherActor)) return;
+	/* 스윕 모드에서는 휘두르기 구간 동안 이미 매 프레임 트레이스 중 */
+	if (bUseSweptTrace || ActorIsSameType(OtherActor)) return;
 
-	FHitResult BoxHit;
-	BoxTrace(BoxHit);
-
-	if (BoxHit.GetActor())
+	if (UWeaponTraceSubsystem* WeaponTrace = GetWorld()->GetSubsystem<UWeaponTraceSubsystem>())
 	{
-		if (ActorIsSameType(BoxHit.GetActor())) return;
+		WeaponTrace->QueueBoxTrace(this);
+	}
+}
+
+void AWeapon::ResolveBoxHit(const FHitResult& BoxHit)
+{
+	AActor* HitActor = BoxHit.GetActor();
+	if (HitActor == nullptr || IgnoreActors.Contains(HitActor)) return;
 
-		UGameplayStatics::ApplyDamage(BoxHit.GetActor(), Damage, GetInstigator()->GetController(), this, UDamageType::StaticClass());
+	IgnoreActors.Add(HitActor);
+	BoxTraceParams.AddIgnoredActor(HitActor);
+	if (ActorIsSameType(HitActor)) return;
+
+	AController* InstigatorController = GetInstigator() ? GetInstigator()->GetController() : nullptr;
+	if (UDamageQueueSubsystem* DamageQueue = GetWorld()->GetSubsystem<UDamageQueueSubsystem>())
+	{
+		FQueuedDamage QueuedDamage;
+		QueuedDamage.Target = HitActor;
+		QueuedDamage.Instigator = InstigatorController;
+		QueuedDamage.Causer = this;
+		QueuedDamage.Hitter = GetOwner();
+		QueuedDamage.Amount = Damage;
+		QueuedDamage.ImpactPoint = BoxHit.ImpactPoint;
+		DamageQueue->QueueDamage(QueuedDamage);
+	}
+	else
+	{
+		UGameplayStatics::ApplyDamage(HitActor, Damage, InstigatorController, this, UDamageType::StaticClass());
 		ExecuteGetHit(BoxHit);
-		CreateFields(BoxHit.ImpactPoint);
 	}
+	CreateFields(BoxHit.ImpactPoint);
 }
 
 bool AWeapon::ActorIsSameType(AActor* OtherActor)
 {
-	return GetOwner()->ActorHasTag(TEXT("Enemy")) && OtherActor->ActorHasTag(TEXT("Enemy"));
+	const ECombatantFlags SharedFlags = ABaseCharacter::GetActorCombatantFlags(GetOwner()) & ABaseCharacter::GetActorCombatantFlags(OtherActor);
+	return EnumHasAnyFlags(SharedFlags, ECombatantFlags::ECF_Enemy);
 }
 
-void AWeapon::ExecuteGetHit(FHitResult& BoxHit)
+void AWeapon::ExecuteGetHit(const FHitResult& BoxHit)
 {
 	IHitInterface* HitInterface = Cast<IHitInterface>(BoxHit.GetActor());
 	if (HitInterface)
@@ -111,32 +144,97 @@ void AWeapon::ExecuteGetHit(FHitResult& BoxHit)
 	}
 }
 
-void AWeapon::BoxTrace(FHitResult& BoxHit)
+FTraceHandle AWeapon::SubmitBoxTrace(UWorld* World)
 {
-	const FVector Start = BoxTraceStarts->GetComponentLocation();
-	const FVector End = BoxTraceEnds->GetComponentLocation();
-
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(this);
-	ActorsToIgnore.Add(GetOwner());
+	FVector Start;
+	FVector End;
+	FQuat Rotation;
+	GetBladeTransform(Start, End, Rotation);
+	return SubmitBoxSweep(World, Start, End, Rotation);
+}
 
-	for (AActor* Actor : IgnoreActors)
+FTraceHandle AWeapon::SubmitBoxSweep(UWorld* World, const FVector& Start, const FVector& End, const FQuat& Rotation)
+{
+	if (bShowBoxDebug)
 	{
-		ActorsToIgnore.AddUnique(Actor);
+		DrawDebugBox(World, Start, BoxTraceExtent, Rotation, FColor::Red, false, 5.f);
+		DrawDebugBox(World, End, BoxTraceExtent, Rotation, FColor::Red, false, 5.f);
 	}
 
-	UKismetSystemLibrary::BoxTraceSingle(
-		this,
+	return World->AsyncSweepByChannel(
+		EAsyncTraceType::Single,
 		Start,
 		End,
-		BoxTraceExtent,
-		BoxTraceStarts->GetComponentRotation(),
-		ETraceTypeQuery::TraceTypeQuery1,
-		false,
-		ActorsToIgnore,
-		bShowBoxDebug ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
-		BoxHit,
-		true
+		Rotation,
+		UEngineTypes::ConvertToCollisionChannel(ETraceTypeQuery::TraceTypeQuery1),
+		FCollisionShape::MakeBox(BoxTraceExtent),
+		BoxTraceParams
+	);
+}
+
+FTraceHandle AWeapon::SubmitBladeSweep(UWorld* World, const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd)
+{
+	const FVector FromBlade = FromEnd - FromStart;
+	const FVector ToBlade = ToEnd - ToStart;
+	const FVector FromCenter = (FromStart + FromEnd) * 0.5;
+	const FVector ToCenter = (ToStart + ToEnd) * 0.5;
+	const FQuat Rotation = FRotationMatrix::MakeFromX(FromBlade + ToBlade).ToQuat();
+	const double HalfLength = (FromBlade.Size() + ToBlade.Size()) * 0.25;
+	const FVector Extent(HalfLength + BoxTraceExtent.X, BoxTraceExtent.Y, BoxTraceExtent.Z);
+
+	if (bShowBoxDebug)
+	{
+		DrawDebugBox(World, FromCenter, Extent, Rotation, FColor::Orange, false, 5.f);
+		DrawDebugBox(World, ToCenter, Extent, Rotation, FColor::Red, false, 5.f);
+	}
+
+	return World->AsyncSweepByChannel(
+		EAsyncTraceType::Single,
+		FromCenter,
+		ToCenter,
+		Rotation,
+		UEngineTypes::ConvertToCollisionChannel(ETraceTypeQuery::TraceTypeQuery1),
+		FCollisionShape::MakeBox(Extent),
+		BoxTraceParams
 	);
-	IgnoreActors.AddUnique(BoxHit.GetActor());
+}
+
+void AWeapon::GetBladeTransform(FVector& OutStart, FVector& OutEnd, FQuat& OutRotation) const
+{
+	OutStart = BoxTraceStarts->GetComponentLocation();
+	OutEnd = BoxTraceEnds->GetComponentLocation();
+	OutRotation = BoxTraceStarts->GetComponentQuat();
+}
+
+void AWeapon::BeginSwing()
+{
+	if (!bUseSweptTrace) return;
+	if (UWeaponTraceSubsystem* WeaponTrace = GetWorld()->GetSubsystem<UWeaponTraceSubsystem>())
+	{
+		WeaponTrace->BeginSwing(this);
+	}
+}
+
+void AWeapon::EndSwing()
+{
+	if (UWeaponTraceSubsystem* WeaponTrace = GetWorld()->GetSubsystem<UWeaponTraceSubsystem>())
+	{
+		WeaponTrace->EndSwing(this);
+	}
+}
+
+void AWeapon::ResetIgnoreActors()
+{
+	IgnoreActors.Empty();
+	ResetBoxTraceParams();
+	++SwingId;
+}
+
+void AWeapon::ResetBoxTraceParams()
+{
+	BoxTraceParams = FCollisionQueryParams(SCENE_QUERY_STAT(WeaponBoxTrace), false, this);
+	if (GetOwner())
+	{
+		BoxTraceParams.AddIgnoredActor(GetOwner());
+	}
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Pool/ActorPoolSubsystem.h"
+#include "Interface/PoolableInterface.h"
+#include "Engine/World.h"
+#include "Slash/Slash.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Spawned"), STAT_PoolSpawned, STATGROUP_SlashPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Reused"), STAT_PoolReused, STATGROUP_SlashPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Free Actors"), STAT_PoolFree, STATGROUP_SlashPool);
+
+void UActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const FActorPoolPrewarm& Entry : PrewarmClasses)
+	{
+		if (UClass* Class = Entry.ActorClass.LoadSynchronous())
+		{
+			Prewarm(Class, Entry.Count);
+		}
+	}
+	// 미리 만든 액터는 정상 상태의 생성 횟수에서 제외
+	NumSpawned = 0;
+	SET_DWORD_STAT(STAT_PoolSpawned, NumSpawned);
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+	Buckets.Empty();
+	NumFree = 0;
+	SET_DWORD_STAT(STAT_PoolFree, NumFree);
+	Super::Deinitialize();
+}
+
+bool UActorPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AActor* UActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform)
+{
+	if (Class == nullptr) return nullptr;
+
+	if (FActorPoolBucket* Bucket = Buckets.Find(Class.Get()))
+	{
+		while (Bucket->FreeActors.Num() > 0)
+		{
+			AActor* Actor = Bucket->FreeActors.Pop(EAllowShrinking::No);
+			--NumFree;
+			if (!IsValid(Actor)) continue;
+
+			Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::TeleportPhysics);
+			if (IPoolableInterface* Poolable = Cast<IPoolableInterface>(Actor))
+			{
+				Poolable->Activate();
+			}
+			++NumReused;
+			SET_DWORD_STAT(STAT_PoolReused, NumReused);
+			SET_DWORD_STAT(STAT_PoolFree, NumFree);
+			return Actor;
+		}
+	}
+
+	AActor* Actor = SpawnPooledActor(Class.Get(), Transform);
+	++NumSpawned;
+	SET_DWORD_STAT(STAT_PoolSpawned, NumSpawned);
+	return Actor;
+}
+
+void UActorPoolSubsystem::Release(AActor* Actor)
+{
+	if (!IsValid(Actor)) return;
+
+	IPoolableInterface* Poolable = Cast<IPoolableInterface>(Actor);
+	if (Poolable == nullptr)
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	Poolable->Deactivate();
+	Buckets.FindOrAdd(Actor->GetClass()).FreeActors.Add(Actor);
+	++NumFree;
+	SET_DWORD_STAT(STAT_PoolFree, NumFree);
+}
+
+void UActorPoolSubsystem::Prewarm(TSubclassOf<AActor> Class, int32 Count)
+{
+	if (Class == nullptr) return;
+
+	const int32 NumExisting = Buckets.FindOrAdd(Class.Get()).FreeActors.Num();
+	for (int32 Index = NumExisting; Index < Count; ++Index)
+	{
+		AActor* Actor = SpawnPooledActor(Class.Get(), FTransform::Identity);
+		++NumSpawned;
+		Release(Actor);
+	}
+}
+
+AActor* UActorPoolSubsystem::SpawnPooledActor(UClass* Class, const FTransform& Transform)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	return GetWorld()->SpawnActor<AActor>(Class, Transform, SpawnParameters);
+}
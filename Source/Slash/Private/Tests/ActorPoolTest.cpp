@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Pool/ActorPoolSubsystem.h"
+#include "Enemy/Enemy.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 적 500 개를 미리 만들어 둔 풀에서 한 프레임에 모두 꺼냅니다.
+ * 새로 생성된 적이 없는지, 꺼내는 데 걸린 시간이 한 프레임(60fps)의 절반보다 짧은지 확인하고 시간을 정보 로그로 남깁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FActorPoolEnemyBenchmark, "Slash.Perf.ActorPool.Enemies", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FActorPoolEnemyBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEnemies = 500;
+	constexpr double FrameBudgetMs = 1000.0 / 60.0;
+
+	FSlashTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+	UActorPoolSubsystem* Pool = World->GetSubsystem<UActorPoolSubsystem>();
+	if (!TestNotNull(TEXT("Actor pool subsystem"), Pool)) return false;
+
+	Pool->Prewarm(AEnemy::StaticClass(), NumEnemies);
+	const int32 NumSpawnedBefore = Pool->GetNumSpawned();
+
+	TArray<AEnemy*> Enemies;
+	Enemies.Reserve(NumEnemies);
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumEnemies; ++Index)
+	{
+		const FVector Location((Index % 25) * 400.0, (Index / 25) * 400.0, 100.0);
+		Enemies.Add(Pool->Acquire<AEnemy>(AEnemy::StaticClass(), FTransform(Location)));
+	}
+	const double AcquireMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	TestEqual(TEXT("Enemies spawned while acquiring from a warm pool"), Pool->GetNumSpawned() - NumSpawnedBefore, 0);
+	TestEqual(TEXT("Enemies acquired"), Enemies.FilterByPredicate([](const AEnemy* Enemy) { return Enemy != nullptr; }).Num(), NumEnemies);
+	TestTrue(FString::Printf(TEXT("Acquiring %d enemies took %.3f ms, under half a frame (%.3f ms)"), NumEnemies, AcquireMs, FrameBudgetMs * 0.5), AcquireMs < FrameBudgetMs * 0.5);
+
+	AddInfo(FString::Printf(TEXT("%d enemies from a warm pool: %.3f ms (%.3f us each)"), NumEnemies, AcquireMs, AcquireMs * 1000.0 / NumEnemies));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Enemy/ChaseFlowFieldSubsystem.h"
+#include "Enemy/Enemy.h"
+#include "Engine/Engine.h"
+#include "Engine/TargetPoint.h"
+#include "Kismet/GameplayStatics.h"
+#include "NavigationPath.h"
+#include "NavigationSystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ChaseFlowFieldTest
+{
+	/* 실행 중인 게임/PIE 월드 (흐름장은 내비메시가 있는 레벨이 필요) */
+	static UWorld* FindGameWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+}
+
+/**
+ * 플레이어 주변 내비메시 위에 추격자 500 명을 세우고 같은 대상까지의 이동 방향을 구하는 비용을 비교합니다.
+ * 1. 적마다 동기 경로 탐색 (흐름장 이전의 추격 방식)
+ * 2. 흐름장 한 장 계산 + 적마다 칸 방향 읽기 (AddChaser)
+ * 내비메시가 있는 레벨을 PIE 또는 -game 으로 실행한 상태에서 돌려야 합니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChaseFlowFieldBenchmark, "Slash.Perf.ChaseFlowField", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FChaseFlowFieldBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumChasers = 500;
+	constexpr float SpawnRadius = 2500.f;
+
+	UWorld* World = ChaseFlowFieldTest::FindGameWorld();
+	if (World == nullptr)
+	{
+		AddWarning(TEXT("No game world is running. Start a level with a navmesh in PIE or -game and run the test again."));
+		return true;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	UChaseFlowFieldSubsystem* FlowField = World->GetSubsystem<UChaseFlowFieldSubsystem>();
+	if (!TestNotNull(TEXT("Navigation system"), NavSys) || !TestNotNull(TEXT("Flow field subsystem"), FlowField)) return false;
+	if (!TestEqual(TEXT("Flow field is idle before the benchmark"), FlowField->GetNumChasers(), 0)) return false;
+
+	/* 대상: 플레이어 (없으면 내비메시 위의 아무 점) */
+	AActor* Target = UGameplayStatics::GetPlayerPawn(World, 0);
+	ATargetPoint* SpawnedTarget = nullptr;
+	if (Target == nullptr)
+	{
+		FNavLocation TargetLocation;
+		if (!NavSys->GetRandomPoint(TargetLocation))
+		{
+			AddError(TEXT("The running level has no navmesh."));
+			return false;
+		}
+		SpawnedTarget = World->SpawnActor<ATargetPoint>(TargetLocation.Location, FRotator::ZeroRotator);
+		Target = SpawnedTarget;
+	}
+	const FVector TargetLocation = Target->GetActorLocation();
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	TArray<AEnemy*> Enemies;
+	Enemies.Reserve(NumChasers);
+	for (int32 Index = 0; Index < NumChasers; ++Index)
+	{
+		FNavLocation SpawnLocation;
+		if (!NavSys->GetRandomReachablePointInRadius(TargetLocation, SpawnRadius, SpawnLocation)) continue;
+
+		AEnemy* Enemy = World->SpawnActor<AEnemy>(AEnemy::StaticClass(), SpawnLocation.Location + FVector(0.f, 0.f, 90.f), FRotator::ZeroRotator, SpawnParameters);
+		if (Enemy)
+		{
+			Enemies.Add(Enemy);
+		}
+	}
+	TestEqual(TEXT("Spawned chasers"), Enemies.Num(), NumChasers);
+
+	int32 NumPathsFound = 0;
+	const double PathStart = FPlatformTime::Seconds();
+	for (const AEnemy* Enemy : Enemies)
+	{
+		const UNavigationPath* Path = UNavigationSystemV1::FindPathToLocationSynchronously(World, Enemy->GetActorLocation(), TargetLocation);
+		NumPathsFound += Path && Path->IsValid() ? 1 : 0;
+	}
+	const double PathSeconds = FPlatformTime::Seconds() - PathStart;
+
+	/* 첫 AddChaser 가 흐름장을 만들고 나머지는 칸 방향만 읽음 */
+	int32 NumJoined = 0;
+	const double FieldStart = FPlatformTime::Seconds();
+	for (AEnemy* Enemy : Enemies)
+	{
+		NumJoined += FlowField->AddChaser(Enemy, Target) ? 1 : 0;
+	}
+	const double FieldSeconds = FPlatformTime::Seconds() - FieldStart;
+
+	TestTrue(TEXT("Some chasers found a path"), NumPathsFound > 0);
+	TestTrue(TEXT("Some chasers joined the flow field"), NumJoined > 0);
+	AddInfo(FString::Printf(TEXT("%d chasers: per-enemy paths %.3f ms (%d found), one flow field %.3f ms (%d joined)"),
+		Enemies.Num(), PathSeconds * 1000.0, NumPathsFound, FieldSeconds * 1000.0, NumJoined));
+
+	/* 추격 상태가 아니므로 다음 틱에 흐름장에서 빠짐 */
+	for (AEnemy* Enemy : Enemies)
+	{
+		Enemy->Destroy();
+	}
+	if (SpawnedTarget)
+	{
+		SpawnedTarget->Destroy();
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
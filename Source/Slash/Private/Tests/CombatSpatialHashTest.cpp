@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Combat/CombatSpatialHash.h"
+#include "Engine/TargetPoint.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 액터 10,000 개를 등록한 공간 해시의 반경 쿼리를 전체 액터 순회(브루트 포스)와 비교합니다.
+ * 두 방식이 같은 액터를 찾는지 확인하고, 걸린 시간을 정보 로그로 남깁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatSpatialHashBenchmark, "Slash.Perf.CombatSpatialHash", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatSpatialHashBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumActors = 10000;
+	constexpr int32 NumQueries = 1000;
+	constexpr double WorldExtent = 50000.0;
+	constexpr double QueryRadius = 1500.0;
+
+	FSlashTestWorld TestWorld;
+	UCombatSpatialHash* SpatialHash = TestWorld.Get()->GetSubsystem<UCombatSpatialHash>();
+	if (!TestNotNull(TEXT("Spatial hash"), SpatialHash)) return false;
+
+	FRandomStream Random(1234);
+	TArray<AActor*> Actors;
+	TArray<ECombatActorType> Types;
+	Actors.Reserve(NumActors);
+	Types.Reserve(NumActors);
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		const FVector Location(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0);
+		AActor* Actor = TestWorld.Get()->SpawnActor<ATargetPoint>(Location, FRotator::ZeroRotator);
+		const ECombatActorType Type = Index % 4 == 0 ? ECombatActorType::ECAT_Breakable : ECombatActorType::ECAT_Enemy;
+		SpatialHash->RegisterActor(Actor, Type);
+		Actors.Add(Actor);
+		Types.Add(Type);
+	}
+	TestEqual(TEXT("Registered actors"), SpatialHash->GetNumActors(), NumActors);
+
+	TArray<FVector> Centers;
+	Centers.Reserve(NumQueries);
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		Centers.Emplace(Random.FRandRange(-WorldExtent, WorldExtent), Random.FRandRange(-WorldExtent, WorldExtent), 0.0);
+	}
+
+	TArray<TArray<AActor*>> HashResults;
+	HashResults.SetNum(NumQueries);
+	const double HashStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		SpatialHash->QueryRadius(Centers[Index], QueryRadius, ECombatActorType::ECAT_Enemy, HashResults[Index]);
+	}
+	const double HashSeconds = FPlatformTime::Seconds() - HashStart;
+
+	TArray<TArray<AActor*>> BruteForceResults;
+	BruteForceResults.SetNum(NumQueries);
+	const double BruteForceStart = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+		{
+			if (!EnumHasAnyFlags(Types[ActorIndex], ECombatActorType::ECAT_Enemy)) continue;
+			if (FVector::DistSquared(Actors[ActorIndex]->GetActorLocation(), Centers[Index]) <= QueryRadius * QueryRadius)
+			{
+				BruteForceResults[Index].Add(Actors[ActorIndex]);
+			}
+		}
+	}
+	const double BruteForceSeconds = FPlatformTime::Seconds() - BruteForceStart;
+
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		HashResults[Index].Sort();
+		BruteForceResults[Index].Sort();
+		if (HashResults[Index] != BruteForceResults[Index])
+		{
+			++NumMismatches;
+		}
+	}
+	TestEqual(TEXT("Queries with different results"), NumMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d radius queries over %d actors: spatial hash %.3f ms, brute force %.3f ms"),
+		NumQueries, NumActors, HashSeconds * 1000.0, BruteForceSeconds * 1000.0));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Characters/SlashCharacter.h"
+#include "Engine/TargetPoint.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 같은 액터 목록에 대해 "EngageableTarget" 태그 검색(ActorHasTag)과 전투원 마스크 검사를 10,000 번씩 수행합니다.
+ * 두 검사의 결과가 같은지 확인하고, 걸린 시간을 정보 로그로 남깁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatantFlagsBenchmark, "Slash.Perf.CombatantFlags", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatantFlagsBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumCharacters = 16;
+	constexpr int32 NumOtherActors = 48;
+	constexpr int32 NumChecks = 10000;
+	constexpr int32 NumRepeats = 20;
+	static const FName EngageableTargetTag(TEXT("EngageableTarget"));
+
+	FSlashTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+
+	/* 캐릭터는 BeginPlay 에서 ECF_EngageableTarget 과 같은 이름의 태그를 받음 */
+	TArray<AActor*> Actors;
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		Actors.Add(World->SpawnActor<ASlashCharacter>(ASlashCharacter::StaticClass(), FTransform(FVector(Index * 200.0, 0.0, 0.0))));
+	}
+	for (int32 Index = 0; Index < NumOtherActors; ++Index)
+	{
+		Actors.Add(World->SpawnActor<ATargetPoint>(FVector(Index * 200.0, 1000.0, 0.0), FRotator::ZeroRotator));
+	}
+
+	TArray<AActor*> Checks;
+	Checks.Reserve(NumChecks);
+	FRandomStream Random(1234);
+	for (int32 Index = 0; Index < NumChecks; ++Index)
+	{
+		Checks.Add(Actors[Random.RandHelper(Actors.Num())]);
+	}
+
+	int32 NumTagged = 0;
+	double TagSeconds = 0.0;
+	for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+	{
+		NumTagged = 0;
+		const double Start = FPlatformTime::Seconds();
+		for (const AActor* Actor : Checks)
+		{
+			NumTagged += Actor->ActorHasTag(EngageableTargetTag) ? 1 : 0;
+		}
+		TagSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	int32 NumFlagged = 0;
+	double MaskSeconds = 0.0;
+	for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+	{
+		NumFlagged = 0;
+		const double Start = FPlatformTime::Seconds();
+		for (const AActor* Actor : Checks)
+		{
+			NumFlagged += EnumHasAnyFlags(ABaseCharacter::GetActorCombatantFlags(Actor), ECombatantFlags::ECF_EngageableTarget) ? 1 : 0;
+		}
+		MaskSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	TestTrue(TEXT("Some checks hit a character"), NumFlagged > 0);
+	TestEqual(TEXT("Tag and mask checks agree"), NumFlagged, NumTagged);
+
+	AddInfo(FString::Printf(TEXT("%d checks (average of %d runs): ActorHasTag %.4f ms, combatant mask %.4f ms"),
+		NumChecks, NumRepeats, TagSeconds * 1000.0 / NumRepeats, MaskSeconds * 1000.0 / NumRepeats));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Characters/BaseCharacter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace HitReactDirectionTest
+{
+	/* 섹션 인덱스 (ABaseCharacter::ClassifyHitReactDirection 과 같은 순서) */
+	enum : int32 { FromFront, FromBack, FromLeft, FromRight };
+
+	/* 예전 DirectionalHitReact 의 Acos 기반 분류 (비교 기준) */
+	static int32 ClassifyWithAcos(const FVector& Forward, const FVector& ToHit)
+	{
+		double Theta = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Forward, ToHit)));
+		if (FVector::CrossProduct(Forward, ToHit).Z < 0)
+		{
+			Theta *= -1.f;
+		}
+
+		if (Theta >= -45.f && Theta < 45.f) return FromFront;
+		if (Theta >= -135.f && Theta < -45.f) return FromLeft;
+		if (Theta >= 45.f && Theta < 135.f) return FromRight;
+		return FromBack;
+	}
+}
+
+/**
+ * 전방/피격 방향을 촘촘히 돌려 가며 내적 경계 분류가 예전 Acos 분류와 같은 섹션을 고르는지 확인합니다.
+ * 경계(±45°, ±135°) 바로 위의 방향은 두 방식 모두 부동소수점 오차로 어느 쪽이든 될 수 있으므로 건너뜁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHitReactDirectionTest, "Slash.Combat.HitReactDirection", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FHitReactDirectionTest::RunTest(const FString& Parameters)
+{
+	using namespace HitReactDirectionTest;
+
+	/* 축 방향 (X 전방, Y 오른쪽) 과 0 벡터 */
+	const FVector Forward = FVector::ForwardVector;
+	TestEqual(TEXT("Front"), ABaseCharacter::ClassifyHitReactDirection(Forward, FVector(1.0, 0.0, 0.0)), int32(FromFront));
+	TestEqual(TEXT("Back"), ABaseCharacter::ClassifyHitReactDirection(Forward, FVector(-1.0, 0.0, 0.0)), int32(FromBack));
+	TestEqual(TEXT("Left"), ABaseCharacter::ClassifyHitReactDirection(Forward, FVector(0.0, -1.0, 0.0)), int32(FromLeft));
+	TestEqual(TEXT("Right"), ABaseCharacter::ClassifyHitReactDirection(Forward, FVector(0.0, 1.0, 0.0)), int32(FromRight));
+	TestEqual(TEXT("Zero vector"), ABaseCharacter::ClassifyHitReactDirection(Forward, FVector::ZeroVector), ClassifyWithAcos(Forward, FVector::ZeroVector));
+
+	constexpr int32 NumForwards = 72;
+	constexpr int32 NumDirections = 7200;
+	constexpr double BoundaryTolerance = 1e-6;
+
+	int32 NumChecked = 0;
+	int32 NumMismatches = 0;
+	for (int32 ForwardIndex = 0; ForwardIndex < NumForwards; ++ForwardIndex)
+	{
+		const double ForwardYaw = 360.0 * ForwardIndex / NumForwards + 0.37;
+		const FVector SweepForward = FRotator(0.0, ForwardYaw, 0.0).Vector();
+
+		for (int32 DirectionIndex = 0; DirectionIndex < NumDirections; ++DirectionIndex)
+		{
+			const double RelativeYaw = -180.0 + 360.0 * DirectionIndex / NumDirections;
+			const double AbsYaw = FMath::Abs(RelativeYaw);
+			if (FMath::IsNearlyEqual(AbsYaw, 45.0, BoundaryTolerance) || FMath::IsNearlyEqual(AbsYaw, 135.0, BoundaryTolerance)) continue;
+
+			const FVector ToHit = FRotator(0.0, ForwardYaw + RelativeYaw, 0.0).Vector();
+			const int32 Expected = ClassifyWithAcos(SweepForward, ToHit);
+			const int32 Actual = ABaseCharacter::ClassifyHitReactDirection(SweepForward, ToHit);
+			++NumChecked;
+			if (Actual != Expected)
+			{
+				if (NumMismatches == 0)
+				{
+					AddError(FString::Printf(TEXT("Forward yaw %.4f, relative yaw %.6f: expected section %d, got %d"), ForwardYaw, RelativeYaw, Expected, Actual));
+				}
+				++NumMismatches;
+			}
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Checked %d directions"), NumChecked));
+	TestEqual(TEXT("Mismatches against Acos classification"), NumMismatches, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
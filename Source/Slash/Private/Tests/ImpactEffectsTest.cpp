@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Combat/ImpactEffectSubsystem.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ImpactEffectsTest
+{
+	constexpr int32 ImpactsPerSecond = 500;
+	constexpr int32 NumFrames = 60;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	/* MergeRadius 로 합쳐지지 않도록 200cm 간격 격자 위의 피격 위치 */
+	static FVector GetImpactLocation(int32 ImpactIndex)
+	{
+		return FVector((ImpactIndex % 25) * 200.0, (ImpactIndex / 25) * 200.0, 100.0);
+	}
+
+	/* 1초 동안 피격 ImpactsPerSecond 개를 프레임마다 고르게 나눠 넣을 때 이 프레임까지 누적된 피격 수 */
+	static int32 GetImpactsUntilFrame(int32 Frame)
+	{
+		return ImpactsPerSecond * Frame / NumFrames;
+	}
+}
+
+/**
+ * 초당 피격 500 개를 1초(60 프레임) 동안
+ * 1. 피격마다 나이아가라 컴포넌트를 스폰 (예전 방식)
+ * 2. UImpactEffectSubsystem::QueueBatchedNiagara 로 상주 컴포넌트 하나에 위치 배열로 기록 (지금 방식)
+ * 으로 처리하며 스폰/기록과 월드 틱을 합친 평균 프레임 시간을 정보 로그로 남깁니다.
+ * DefaultGame.ini 의 DefaultHitImpactSystem 이 비어 있으면 비교할 시스템이 없으므로 경고만 남기고 건너뜁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImpactEffectsBenchmark, "Slash.Perf.ImpactEffects", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FImpactEffectsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace ImpactEffectsTest;
+
+	double PerImpactSeconds = 0.0;
+	{
+		FSlashTestWorld TestWorld;
+		UWorld* World = TestWorld.Get();
+		UImpactEffectSubsystem* ImpactEffects = World->GetSubsystem<UImpactEffectSubsystem>();
+		if (!TestNotNull(TEXT("Impact effect subsystem"), ImpactEffects)) return false;
+
+		UNiagaraSystem* System = ImpactEffects->GetDefaultHitImpactSystem();
+		if (System == nullptr)
+		{
+			AddWarning(TEXT("No DefaultHitImpactSystem configured for UImpactEffectSubsystem, skipping the impact effect comparison"));
+			return true;
+		}
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double FrameStart = FPlatformTime::Seconds();
+			for (int32 ImpactIndex = GetImpactsUntilFrame(Frame); ImpactIndex < GetImpactsUntilFrame(Frame + 1); ++ImpactIndex)
+			{
+				UNiagaraFunctionLibrary::SpawnSystemAtLocation(World, System, GetImpactLocation(ImpactIndex), FRotator::ZeroRotator, FVector(1.f), true, true, ENCPoolMethod::AutoRelease);
+			}
+			TestWorld.Tick(DeltaTime);
+			PerImpactSeconds += FPlatformTime::Seconds() - FrameStart;
+		}
+	}
+
+	double BatchedSeconds = 0.0;
+	{
+		FSlashTestWorld TestWorld;
+		UWorld* World = TestWorld.Get();
+		UImpactEffectSubsystem* ImpactEffects = World->GetSubsystem<UImpactEffectSubsystem>();
+		if (!TestNotNull(TEXT("Impact effect subsystem"), ImpactEffects)) return false;
+
+		UNiagaraSystem* System = ImpactEffects->GetDefaultHitImpactSystem();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const double FrameStart = FPlatformTime::Seconds();
+			for (int32 ImpactIndex = GetImpactsUntilFrame(Frame); ImpactIndex < GetImpactsUntilFrame(Frame + 1); ++ImpactIndex)
+			{
+				ImpactEffects->QueueBatchedNiagara(System, GetImpactLocation(ImpactIndex));
+			}
+			TestWorld.Tick(DeltaTime);
+			BatchedSeconds += FPlatformTime::Seconds() - FrameStart;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d impacts/s over %d frames, per frame: component per impact (old) %.3f ms, batched positions (new) %.3f ms"),
+		ImpactsPerSecond, NumFrames, PerImpactSeconds * 1000.0 / NumFrames, BatchedSeconds * 1000.0 / NumFrames));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Item/Item.h"
+#include "Item/ItemHoverSubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * 떠 있는 아이템 10,000 개에 대해
+ * 1. 서브시스템 한 프레임 (화면 밖: 오프셋 계산만)
+ * 2. 아이템마다 액터 이동 (예전 방식: 트랜스폼 전파 + Sphere 겹침 갱신 + 공간 해시 갱신)
+ * 3. 아이템마다 충돌 없는 HoverMesh 상대 위치 갱신 (지금 방식: 화면에 보이는 아이템)
+ * 의 시간을 정보 로그로 남깁니다.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FItemHoverBenchmark, "Slash.Perf.ItemHover", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FItemHoverBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumItems = 10000;
+	constexpr int32 NumFrames = 10;
+	constexpr float DeltaTime = 1.f / 60.f;
+
+	FSlashTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+	UItemHoverSubsystem* HoverSubsystem = World->GetSubsystem<UItemHoverSubsystem>();
+	if (!TestNotNull(TEXT("Item hover subsystem"), HoverSubsystem)) return false;
+
+	TArray<AItem*> Items;
+	TArray<UStaticMeshComponent*> Meshes;
+	Items.Reserve(NumItems);
+	Meshes.Reserve(NumItems);
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		const FVector Location((Index % 100) * 300.0, (Index / 100) * 300.0, 100.0);
+		AItem* Item = World->SpawnActor<AItem>(AItem::StaticClass(), FTransform(Location));
+		Items.Add(Item);
+		TInlineComponentArray<UStaticMeshComponent*> ItemMeshes(Item);
+		for (UStaticMeshComponent* Mesh : ItemMeshes)
+		{
+			if (Mesh->GetFName() == TEXT("HoverMesh"))
+			{
+				Meshes.Add(Mesh);
+			}
+		}
+	}
+	TestEqual(TEXT("Hovering items"), HoverSubsystem->GetNumItems(), NumItems);
+	if (!TestEqual(TEXT("Hover meshes"), Meshes.Num(), NumItems)) return false;
+
+	double SubsystemSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double Start = FPlatformTime::Seconds();
+		HoverSubsystem->Tick(DeltaTime);
+		SubsystemSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	double ActorOffsetSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float Offset = Frame % 2 == 0 ? 1.f : -1.f;
+		const double Start = FPlatformTime::Seconds();
+		for (AItem* Item : Items)
+		{
+			Item->AddActorWorldOffset(FVector(0.f, 0.f, Offset));
+		}
+		ActorOffsetSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	double HoverMeshSeconds = 0.0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const float Offset = Frame % 2 == 0 ? 1.f : -1.f;
+		const double Start = FPlatformTime::Seconds();
+		for (UStaticMeshComponent* Mesh : Meshes)
+		{
+			Mesh->SetRelativeLocation(FVector(0.f, 0.f, Offset));
+		}
+		HoverMeshSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d hovering items, per frame: subsystem tick (off-screen) %.3f ms, actor offset (old) %.3f ms, hover mesh offset (all visible) %.3f ms"),
+		NumItems, SubsystemSeconds * 1000.0 / NumFrames, ActorOffsetSeconds * 1000.0 / NumFrames, HoverMeshSeconds * 1000.0 / NumFrames));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
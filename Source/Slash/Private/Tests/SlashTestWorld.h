@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/**
+ * 자동화 테스트용 빈 게임 월드
+ * 월드 타입이 Game 이라 DoesSupportWorldType 이 Game/PIE 인 Slash 월드 서브시스템도 함께 생성됩니다.
+ * 범위를 벗어나면 월드를 정리합니다.
+ */
+class FSlashTestWorld
+{
+public:
+	FSlashTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SlashTestWorld"));
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FSlashTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World->RemoveFromRoot();
+	}
+
+	FSlashTestWorld(const FSlashTestWorld&) = delete;
+	FSlashTestWorld& operator=(const FSlashTestWorld&) = delete;
+
+	FORCEINLINE UWorld* Get() const { return World; }
+
+	/* 월드와 틱 가능한 서브시스템을 한 프레임 진행 */
+	void Tick(float DeltaTime)
+	{
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+private:
+	UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
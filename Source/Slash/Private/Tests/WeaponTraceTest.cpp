@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Misc/AutomationTest.h"
+#include "Combat/WeaponTraceSubsystem.h"
+#include "Item/Weapons/Weapon.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Tests/SlashTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace WeaponTraceTest
+{
+	/* 무기 트레이스 채널을 막는 박스 하나짜리 과녁 */
+	static AActor* SpawnTarget(UWorld* World, const FVector& Location)
+	{
+		AActor* Target = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+		UBoxComponent* Box = NewObject<UBoxComponent>(Target);
+		Box->SetBoxExtent(FVector(60.f));
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Target->SetRootComponent(Box);
+		Box->RegisterComponent();
+		Box->SetWorldLocation(Location);
+		return Target;
+	}
+}
+
+/**
+ * 무기 200 개가 동시에 휘두르는 상황에서 매 프레임 박스 트레이스를 예약하고 월드를 진행합니다.
+ * 휘두르기마다 무기가 자기 과녁만 정확히 한 번 맞히는지 확인하고, 평균 프레임 시간을 정보 로그로 남깁니다.
+ * (제출/처리 시간의 세부는 stat SlashCombat)
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeaponTraceStressTest, "Slash.Perf.WeaponTrace.ConcurrentSwings", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWeaponTraceStressTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumWeapons = 200;
+	constexpr int32 NumSwings = 3;
+	constexpr int32 FramesPerSwing = 20;
+	constexpr float DeltaTime = 1.f / 60.f;
+	constexpr double Spacing = 1000.0;
+
+	FSlashTestWorld TestWorld;
+	UWorld* World = TestWorld.Get();
+	UWeaponTraceSubsystem* WeaponTrace = World->GetSubsystem<UWeaponTraceSubsystem>();
+	if (!TestNotNull(TEXT("Weapon trace subsystem"), WeaponTrace)) return false;
+
+	TArray<AWeapon*> Weapons;
+	TArray<AActor*> Targets;
+	for (int32 Index = 0; Index < NumWeapons; ++Index)
+	{
+		const FVector Location((Index % 20) * Spacing, (Index / 20) * Spacing, 0.0);
+		Targets.Add(WeaponTraceTest::SpawnTarget(World, Location));
+		Weapons.Add(World->SpawnActor<AWeapon>(AWeapon::StaticClass(), FTransform(Location)));
+	}
+
+	double TotalSeconds = 0.0;
+	for (int32 Swing = 0; Swing < NumSwings; ++Swing)
+	{
+		for (AWeapon* Weapon : Weapons)
+		{
+			Weapon->ResetIgnoreActors();
+		}
+
+		for (int32 Frame = 0; Frame < FramesPerSwing; ++Frame)
+		{
+			for (AWeapon* Weapon : Weapons)
+			{
+				WeaponTrace->QueueBoxTrace(Weapon);
+			}
+
+			const double FrameStart = FPlatformTime::Seconds();
+			TestWorld.Tick(DeltaTime);
+			TotalSeconds += FPlatformTime::Seconds() - FrameStart;
+		}
+
+		int32 NumWrongHits = 0;
+		for (int32 Index = 0; Index < NumWeapons; ++Index)
+		{
+			const TArray<AActor*>& HitActors = Weapons[Index]->IgnoreActors;
+			if (HitActors.Num() != 1 || HitActors[0] != Targets[Index])
+			{
+				++NumWrongHits;
+			}
+		}
+		TestEqual(FString::Printf(TEXT("Swing %d: weapons without exactly one hit on their own target"), Swing), NumWrongHits, 0);
+	}
+
+	AddInfo(FString::Printf(TEXT("%d concurrent swings: %.3f ms per frame on average over %d frames"),
+		NumWeapons, TotalSeconds * 1000.0 / (NumSwings * FramesPerSwing), NumSwings * FramesPerSwing));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -6,11 +6,13 @@
 #include "CharacterType.h"
 #include "GameFramework/Character.h"
 #include "Interface/HitInterface.h"
+#include "Characters/MontageSectionCache.h"
 #include "BaseCharacter.generated.h"
 
 class AWeapon;
 class UAnimMontage;
 class UAttributeComponent;
+class UNiagaraSystem;
 
 UCLASS()
 class SLASH_API ABaseCharacter : public ACharacter, public IHitInterface
@@ -18,14 +20,31 @@ class SLASH_API ABaseCharacter : public ACharacter, public IHitInterface
 	GENERATED_BODY()
 
 public:
-	ABaseCharacter();
+	ABaseCharacter(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	virtual void Tick(float DeltaTime) override;
 
 	FORCEINLINE TEnumAsByte<EDeathPose> GetDeathPose() const { return DeathPose; }
+	FORCEINLINE AActor* GetCombatTarget() const { return CombatTarget; }
+	FORCEINLINE ECombatantFlags GetCombatantFlags() const { return CombatantFlags; }
+	FORCEINLINE bool HasCombatantFlags(ECombatantFlags Flags) const { return EnumHasAllFlags(CombatantFlags, Flags); }
+
+	/**
+	 * 액터의 전투원 플래그를 반환합니다. 캐릭터가 아니거나 null 이면 ECF_None
+	 */
+	static ECombatantFlags GetActorCombatantFlags(const AActor* Actor);
+
+	/**
+	 * 맞은 방향을 피격 몽타주 섹션 인덱스로 분류합니다. (0 FromFront, 1 FromBack, 2 FromLeft, 3 FromRight)
+	 * @param Forward 맞은 캐릭터의 수평 전방 단위 벡터
+	 * @param ToHit 맞은 캐릭터 → 공격자 수평 단위 벡터 (0 벡터면 FromRight)
+	 * @return HitReactSections 순서의 섹션 인덱스
+	 */
+	static int32 ClassifyHitReactDirection(const FVector& Forward, const FVector& ToHit);
 
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
 	virtual void Attack();
 	virtual void Die();
@@ -33,7 +52,7 @@ protected:
 	virtual bool CanAttack();
 	
 	virtual void PlayHitAttackMontage();
-	virtual void PlayHitReactMontage(const FName& SectionName); // 피격 몽타주 재생
+	virtual void PlayHitReactMontage(int32 SectionIndex); // 피격 몽타주 재생 (HitReactSections 순서의 인덱스)
 	virtual int32 PlayAttackMontage();
 	virtual int32 PlayDeathMontage();
 	virtual void PlayDodgeMontage();
@@ -44,6 +63,19 @@ protected:
 	void SpawnHitParticles(const FVector& ImpactPoint);
 	void DisableCapsule();
 	void DisableMeshCollision();
+
+	/**
+	 * 사망 처리로 바뀐 상태를 기본값으로 되돌립니다. (풀에서 재사용될 때)
+	 * 속성, 사망 플래그(ECF_Dead), 캡슐/메시 충돌, 사망 포즈, 재생 중인 몽타주를 초기화합니다.
+	 */
+	void ResetCharacterState();
+
+	/**
+	 * 전투원 플래그를 켜거나 끕니다. 같은 이름의 액터 태그도 함께 추가/제거합니다. (블루프린트 호환)
+	 * @param Flags 바꿀 플래그
+	 * @param bEnabled 켤지 여부
+	 */
+	void SetCombatantFlags(ECombatantFlags Flags, bool bEnabled);
 	
 	bool IsAlive();
 
@@ -79,6 +111,14 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, Category = Combat)
 	UParticleSystem* HitParticles;
+
+	/**
+	 * 일괄 피격 이펙트 (UImpactEffectSubsystem 의 상주 컴포넌트가 ImpactPositions 배열로 한 프레임 분량을 한 번에 스폰)
+	 * 지정하면 HitParticles 대신 사용합니다. 시스템은 ImpactPositions 배열 원소마다 월드 좌표에서 한 번 터지도록 만들어야 합니다.
+	 * 비워 두면 UImpactEffectSubsystem 의 DefaultHitImpactSystem 을, 그것도 없으면 HitParticles 를 사용합니다.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = Combat)
+	UNiagaraSystem* HitImpactSystem;
 	
 	UPROPERTY(EditDefaultsOnly, Category = Combat)
 	UParticleSystem* AttackStamina;
@@ -89,10 +129,24 @@ protected:
 	UPROPERTY(BlueprintReadOnly)
 	TEnumAsByte<EDeathPose> DeathPose;
 
+	/* 진영/상태 비트마스크 (SetCombatantFlags 로만 변경) */
+	ECombatantFlags CombatantFlags = ECombatantFlags::ECF_None;
+
 
 private:
-	void PlayMontageSection(UAnimMontage* Montage, const FName& SectionName);
-	int32 PlayRandomMontageSection(UAnimMontage* Montage, const TArray<FName>& SectionNames);
+	/* 몽타주별 섹션 시작 시간 캐시를 만듭니다. (BeginPlay) */
+	void BuildMontageSectionCaches();
+
+	/**
+	 * 캐시된 섹션 중 하나를 무작위로 골라 재생합니다.
+	 * @return 고른 섹션 인덱스, 섹션이 없으면 -1
+	 */
+	int32 PlayRandomMontageSection(const FMontageSectionCache& Sections);
+
+	FMontageSectionCache AttackSectionCache;
+	FMontageSectionCache DeathSectionCache;
+	FMontageSectionCache HitReactSectionCache;
+	FMontageSectionCache DodgeSectionCache;
 
 	/* ==== Animation 몽타주 ==== */
 	UPROPERTY(EditDefaultsOnly, Category = Combat)
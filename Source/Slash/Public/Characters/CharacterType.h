@@ -39,6 +39,25 @@ enum EDeathPose
 	EDP_MAX UMETA(DisplayName = "DefalultMAX")
 };
 
+/**
+ * 전투원 진영/상태 비트마스크
+ * 아군 오사 방지와 대상 검사를 태그(FName) 검색 대신 마스크 한 번으로 처리합니다.
+ * 같은 이름의 액터 태그("Enemy", "EngageableTarget", "Dead")는 블루프린트 호환용으로 함께 유지됩니다.
+ * 태그는 ABaseCharacter::SetCombatantFlags 가 마스크를 따라 쓰기만 하며, C++ 필터(무기 적중, 추격 대상, 사망 검사)는 태그를 읽지 않습니다.
+ * 따라서 블루프린트/레벨 기본값에서 태그만 직접 붙이거나 떼면 더 이상 필터에 반영되지 않습니다. (ABaseCharacter 가 아닌 액터는 항상 ECF_None)
+ */
+enum class ECombatantFlags : uint8
+{
+	ECF_None = 0,
+	/* 적 진영 */
+	ECF_Enemy = 1 << 0,
+	/* 적이 추격/공격할 수 있는 대상 (플레이어) */
+	ECF_EngageableTarget = 1 << 1,
+	/* 사망 */
+	ECF_Dead = 1 << 2
+};
+ENUM_CLASS_FLAGS(ECombatantFlags)
+
 UENUM(BlueprintType)
 enum class EEnemyState : uint8
 {
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimMontage;
+class UAnimInstance;
+
+/**
+ * 몽타주 섹션들의 시작 시간을 미리 계산해 둔 캐시
+ * 재생할 때마다 이름으로 섹션을 찾는(Montage_JumpToSection) 대신 인덱스로 시작 시간을 꺼내
+ * Montage_Play 의 시작 위치로 바로 넘깁니다.
+ * 없는 섹션은 Build 시점에 경고를 남기고 몽타주 처음(0초)부터 재생합니다. (이전 동작과 같음)
+ */
+struct FMontageSectionCache
+{
+	/**
+	 * 섹션 이름 목록의 시작 시간을 계산합니다. (BeginPlay 에서 한 번)
+	 * @param InMontage 대상 몽타주 (null 이면 섹션 수만 유지하고 재생하지 않음)
+	 * @param SectionNames 섹션 이름 목록, 캐시 인덱스는 이 순서를 따름
+	 * @param Owner 경고 로그에 표시할 소유자
+	 */
+	void Build(UAnimMontage* InMontage, TArrayView<const FName> SectionNames, const UObject* Owner);
+
+	/**
+	 * 캐시된 인덱스의 섹션부터 몽타주를 재생합니다.
+	 * @return 재생했으면 true
+	 */
+	bool Play(UAnimInstance* AnimInstance, int32 SectionIndex) const;
+
+	FORCEINLINE int32 Num() const { return StartTimes.Num(); }
+
+private:
+	/* 소유 캐릭터의 UPROPERTY 가 참조를 유지하므로 여기서는 원시 포인터 */
+	UAnimMontage* Montage = nullptr;
+
+	/* 섹션별 시작 시간(초) */
+	TArray<float> StartTimes;
+};
@@ -8,6 +8,19 @@
 #include "CharacterType.h"
 #include "SlashAnimInstance.generated.h"
 
+/**
+ * 게임 스레드에서 한 번에 복사해 두는 캐릭터 상태
+ * 애님 워커 스레드는 캐릭터/무브먼트 컴포넌트 대신 이 값만 읽습니다.
+ */
+struct FSlashAnimSnapshot
+{
+	FVector Velocity = FVector::ZeroVector;
+	bool bIsFalling = false;
+	ECharacterState CharacterState = ECharacterState::ECS_Unequipped;
+	EActionState ActionState = EActionState::EAS_Unoccupied;
+	TEnumAsByte<EDeathPose> DeathPose;
+};
+
 /**
  * 
  */
@@ -20,9 +33,12 @@ public:
 	/* 애니메이션 초기화 */
 	virtual void NativeInitializeAnimation() override;
 
-	/* 애니메이션 업데이트(Tick 같은 개념) */
+	/* 게임 스레드: 캐릭터 상태를 Snapshot 에 복사만 함 */
 	virtual void NativeUpdateAnimation(float DeltaTime) override;
 
+	/* 워커 스레드: Snapshot 으로 애님 그래프 변수 계산 */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
+
 	/* 슬래시 캐릭터 선언 BlueprintReadOnly = 블루프린트에서만 접근 가능 */
 	UPROPERTY(BlueprintReadOnly)
 	class ASlashCharacter* SlashCharacter;
@@ -46,4 +62,7 @@ public:
 
 	UPROPERTY(BlueprintReadOnly, Category = Movement)
 	TEnumAsByte<EDeathPose> DeathPose;
+
+private:
+	FSlashAnimSnapshot Snapshot;
 };
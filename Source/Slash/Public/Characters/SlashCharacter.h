@@ -29,7 +29,6 @@ class SLASH_API ASlashCharacter : public ABaseCharacter, public IPickupInterface
 
 public:
 	ASlashCharacter();
-	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
@@ -62,7 +61,8 @@ protected:
 	virtual void AttackEnd() override;
 	virtual bool CanAttack() override;
 	virtual void Die() override;
-	void PlayEquipMontage(const FName& SectionName);
+	/* EquipSection 순서의 섹션 인덱스로 장착/해제 몽타주 재생 */
+	void PlayEquipMontage(int32 SectionIndex);
 	bool CanDisarm();
 	bool CanArm();
 	bool IsOccupied();
@@ -130,8 +130,6 @@ protected:
 
 	
 private:
-	void SetHUDHealth();
-	void SetHUDStamina();
 	bool IsUnoccupied();
 	void InitializeSlashOverlay();
 
@@ -177,6 +175,9 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = Montages)
 	UAnimMontage* EquipMontage;
 
+	/* EquipMontage 의 섹션 시작 시간 캐시 (BeginPlay) */
+	FMontageSectionCache EquipSectionCache;
+
 	/* VisibleInstanceOnly = 디테일 패널에서만 볼수있음 */
 	UPROPERTY(VisibleInstanceOnly)
 	AItem* OverlappingItem;
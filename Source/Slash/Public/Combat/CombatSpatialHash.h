@@ -0,0 +1,95 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSpatialHash.generated.h"
+
+/**
+ * 공간 해시에 등록되는 전투 관련 액터 종류 (쿼리 필터용 비트마스크)
+ */
+enum class ECombatActorType : uint8
+{
+	ECAT_None = 0,
+	ECAT_Player = 1 << 0,
+	ECAT_Enemy = 1 << 1,
+	ECAT_Breakable = 1 << 2,
+	ECAT_Pickup = 1 << 3,
+
+	ECAT_All = ECAT_Player | ECAT_Enemy | ECAT_Breakable | ECAT_Pickup
+};
+ENUM_CLASS_FLAGS(ECombatActorType);
+
+/**
+ * 플레이어/적/부서지는 액터/줍는 아이템을 균일 격자(XY)로 나눠 보관하는 공간 해시
+ * 액터의 루트 컴포넌트가 움직일 때마다 칸이 바뀐 경우에만 갱신되며,
+ * 반경 쿼리는 주변 칸만 훑고 제곱 거리로 비교합니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UCombatSpatialHash : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/**
+	 * 액터를 등록하고 이동할 때마다 위치를 갱신하도록 합니다.
+	 * @param Actor 등록할 액터
+	 * @param Type 쿼리 필터에 쓰일 액터 종류
+	 */
+	void RegisterActor(AActor* Actor, ECombatActorType Type);
+
+	/**
+	 * 액터를 해시에서 제거합니다. 등록되지 않은 액터면 아무것도 하지 않습니다.
+	 * @param Actor 제거할 액터
+	 */
+	void UnregisterActor(AActor* Actor);
+
+	/**
+	 * Center 로부터 Radius 안에 있는 액터를 찾습니다.
+	 * @param Center 검색 중심
+	 * @param Radius 검색 반경
+	 * @param TypeMask 찾을 액터 종류
+	 * @param OutActors 결과 (기존 내용은 유지하고 뒤에 추가)
+	 */
+	void QueryRadius(const FVector& Center, double Radius, ECombatActorType TypeMask, TArray<AActor*>& OutActors) const;
+
+	FORCEINLINE int32 GetNumActors() const { return ActorToEntry.Num(); }
+
+private:
+	struct FEntry
+	{
+		AActor* Actor = nullptr;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+
+		/* Cell 의 목록 안에서 자신의 위치 (제거 시 O(1) 스왑용) */
+		int32 IndexInCell = INDEX_NONE;
+		ECombatActorType Type = ECombatActorType::ECAT_None;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 EntryIndex);
+	void UpdateEntryLocation(int32 EntryIndex, const FVector& NewLocation);
+	void AddToCell(int32 EntryIndex);
+	void RemoveFromCell(int32 EntryIndex);
+
+	FORCEINLINE FIntPoint ToCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+	}
+
+	/* 격자 한 칸의 크기 */
+	UPROPERTY(Config)
+	float CellSize = 500.f;
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	TMap<const AActor*, int32> ActorToEntry;
+};
@@ -0,0 +1,104 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "DamageQueueSubsystem.generated.h"
+
+class UDamageQueueSubsystem;
+
+/**
+ * 프레임 동안 쌓인 데미지 이벤트 하나
+ */
+struct FQueuedDamage
+{
+	/* 피해를 받을 액터 */
+	TWeakObjectPtr<AActor> Target;
+
+	/* 데미지를 가한 컨트롤러 (TakeDamage 의 EventInstigator) */
+	TWeakObjectPtr<AController> Instigator;
+
+	/* 데미지를 가한 액터 (무기) */
+	TWeakObjectPtr<AActor> Causer;
+
+	/* 피격 반응 방향을 정할 액터 (무기 소유자) */
+	TWeakObjectPtr<AActor> Hitter;
+
+	float Amount = 0.f;
+	FVector ImpactPoint = FVector::ZeroVector;
+};
+
+/**
+ * 데미지 큐를 고정된 틱 그룹에서 처리하기 위한 틱 함수
+ */
+USTRUCT()
+struct FDamageQueueTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UDamageQueueSubsystem* Target = nullptr;
+
+	/* <FTickFunction> */
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	/* </FTickFunction> */
+};
+
+template<>
+struct TStructOpsTypeTraits<FDamageQueueTickFunction> : public TStructOpsTypeTraitsBase2<FDamageQueueTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ * 무기 적중을 그 자리에서 처리하지 않고 프레임 단위로 모아 한 번에 처리하는 서브시스템
+ * 1. 적중 시 데미지 이벤트(대상, 가해자, 무기, 피해량, 적중 위치)를 큐에 쌓음
+ * 2. 다음 프레임 TG_PrePhysics 에서 대상별로 묶어(처음 맞은 순서 유지) 피해량을 합산
+ * 3. 대상마다 ApplyDamage 한 번, GetHit 한 번만 호출
+ *
+ * 한 프레임에 같은 대상이 여러 번 맞아도 체력바/HUD 갱신, 피격 사운드, 파티클, 사망 처리는 한 번씩만 일어나고
+ * 처리 순서는 큐에 들어온 순서로 고정됩니다.
+ */
+UCLASS()
+class SLASH_API UDamageQueueSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/**
+	 * 데미지 이벤트를 큐에 추가합니다. 실제 처리는 다음 ResolveQueuedDamage 에서 일어납니다.
+	 * @param Damage 데미지 이벤트
+	 */
+	void QueueDamage(const FQueuedDamage& Damage);
+
+	/* 쌓인 데미지 이벤트를 대상별로 합쳐 처리합니다. (틱 함수에서 호출) */
+	void ResolveQueuedDamage();
+
+private:
+	/* 한 대상에게 이번 프레임에 들어온 데미지를 합친 결과 */
+	struct FTargetDamage
+	{
+		/* 대상에게 들어온 첫 이벤트 (가해자/적중 위치는 첫 적중 기준) */
+		int32 FirstEventIndex = INDEX_NONE;
+		float TotalAmount = 0.f;
+	};
+
+	FDamageQueueTickFunction TickFunction;
+
+	TArray<FQueuedDamage> QueuedDamage;
+
+	/* 처리 중인 이벤트 (처리 도중 새로 들어온 이벤트는 QueuedDamage 에 남아 다음 프레임에 처리) */
+	TArray<FQueuedDamage> ResolvingDamage;
+
+	/* 처리 중 재사용하는 배열 (처음 맞은 순서대로) */
+	TArray<FTargetDamage> TargetDamage;
+	TMap<AActor*, int32> TargetToIndex;
+};
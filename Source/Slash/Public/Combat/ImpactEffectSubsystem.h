@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ImpactEffectSubsystem.generated.h"
+
+class USoundBase;
+class UParticleSystem;
+class UNiagaraSystem;
+class UNiagaraComponent;
+
+/**
+ * 피격/줍기 이펙트와 사운드를 프레임 단위로 모아 재생하는 서브시스템
+ * 1. 이번 프레임의 요청을 모으면서 같은 에셋이 MergeRadius 안에 이미 있으면 하나로 합침
+ * 2. 틱에서 카메라와 가까운 순으로 정렬해 프레임당 예산(MaxEffectsPerFrame, MaxSoundsPerFrame)만큼만 재생
+ * 3. 파티클/나이아가라 컴포넌트는 AutoRelease 풀에서 꺼내 쓰고 끝나면 풀로 돌아감
+ *
+ * 전투 피격 이펙트(QueueBatchedNiagara)는 시스템마다 하나씩 상주하는 나이아가라 컴포넌트로 보냅니다.
+ * 이번 프레임의 피격 위치를 배열 데이터 인터페이스(BatchedPositionsParameter)에 한 번에 써 넣고
+ * 시스템이 그 배열의 원소마다 파티클을 스폰하므로 피격 수와 상관없이 컴포넌트는 하나입니다.
+ * 캐릭터에 HitImpactSystem 이 없으면 DefaultHitImpactSystem (Config) 을 씁니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UImpactEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 이번 프레임에 재생할 사운드를 예약합니다.
+	 * @param Sound 재생할 사운드
+	 * @param Location 재생 위치
+	 */
+	void QueueSound(USoundBase* Sound, const FVector& Location);
+
+	/**
+	 * 이번 프레임에 생성할 캐스케이드 파티클을 예약합니다.
+	 * @param Particles 생성할 파티클 시스템
+	 * @param Location 생성 위치
+	 */
+	void QueueParticles(UParticleSystem* Particles, const FVector& Location);
+
+	/**
+	 * 이번 프레임에 생성할 나이아가라 시스템을 예약합니다.
+	 * @param System 생성할 나이아가라 시스템
+	 * @param Location 생성 위치
+	 */
+	void QueueNiagara(UNiagaraSystem* System, const FVector& Location);
+
+	/**
+	 * 이번 프레임의 피격 위치를 상주 나이아가라 컴포넌트에 기록하도록 예약합니다.
+	 * 시스템은 BatchedPositionsParameter 이름의 User 위치 배열을 읽어 원소마다 스폰하도록 만들어져 있어야 합니다.
+	 * @param System 피격 이펙트 시스템
+	 * @param Location 피격 위치
+	 */
+	void QueueBatchedNiagara(UNiagaraSystem* System, const FVector& Location);
+
+	/**
+	 * 캐릭터에 HitImpactSystem 이 지정되지 않았을 때 쓸 일괄 피격 이펙트를 반환합니다.
+	 * @return DefaultHitImpactSystem 이 설정되지 않았거나 로드에 실패하면 nullptr
+	 */
+	FORCEINLINE UNiagaraSystem* GetDefaultHitImpactSystem() const { return LoadedDefaultHitImpactSystem; }
+
+private:
+	struct FImpactRequest
+	{
+		UObject* Asset = nullptr;
+		FVector Location = FVector::ZeroVector;
+		float DistanceSquared = 0.f;
+	};
+
+	/**
+	 * 같은 에셋의 요청이 MergeRadius 안에 이미 있으면 합치고, 없으면 추가합니다.
+	 */
+	void AddRequest(TArray<FImpactRequest>& Requests, UObject* Asset, const FVector& Location);
+
+	/**
+	 * 카메라와 가까운 순으로 정렬한 뒤 예산만큼 앞에서부터 남기고 나머지는 버립니다.
+	 * @return 버린 요청 수
+	 */
+	int32 ApplyBudget(TArray<FImpactRequest>& Requests, int32 Budget, const FVector& CameraLocation) const;
+
+	void PlayEffects();
+	void PlaySounds();
+
+	/* 시스템별 피격 위치 배열을 상주 컴포넌트에 써 넣습니다. */
+	void FlushBatchedImpacts();
+
+	/* 시스템의 상주 컴포넌트 (처음 쓰일 때 월드 원점에 만듦) */
+	UNiagaraComponent* FindOrCreateBatchedComponent(UNiagaraSystem* System);
+
+	/* 같은 프레임에 이 거리(cm) 안에 떨어진 같은 에셋은 하나로 재생 */
+	UPROPERTY(Config)
+	float MergeRadius = 50.f;
+
+	/* 프레임당 최대 이펙트 수 (파티클 + 나이아가라) */
+	UPROPERTY(Config)
+	int32 MaxEffectsPerFrame = 8;
+
+	/* 프레임당 최대 사운드 수 */
+	UPROPERTY(Config)
+	int32 MaxSoundsPerFrame = 4;
+
+	/* 프레임당 최대 피격 기록 수 (상주 컴포넌트 하나에 몰아 쓰므로 개별 이펙트보다 넉넉하게) */
+	UPROPERTY(Config)
+	int32 MaxBatchedImpactsPerFrame = 64;
+
+	/* 상주 시스템이 읽는 User 위치 배열 파라미터 이름 */
+	UPROPERTY(Config)
+	FName BatchedPositionsParameter = TEXT("ImpactPositions");
+
+	/* HitImpactSystem 이 없는 캐릭터가 쓰는 일괄 피격 이펙트 (BatchedPositionsParameter 배열을 읽는 시스템, 월드 생성 시 한 번 로드) */
+	UPROPERTY(Config)
+	TSoftObjectPtr<UNiagaraSystem> DefaultHitImpactSystem;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UNiagaraSystem> LoadedDefaultHitImpactSystem;
+
+	/* 파티클/나이아가라 요청 (에셋 타입으로 구분) */
+	TArray<FImpactRequest> EffectRequests;
+	TArray<FImpactRequest> SoundRequests;
+	TArray<FImpactRequest> BatchedRequests;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UNiagaraSystem>, TObjectPtr<UNiagaraComponent>> BatchedComponents;
+
+	/* 지난 프레임에 기록이 있었던 시스템 (이번 프레임에 비어 있으면 배열을 비워 스폰을 멈춤) */
+	TSet<UNiagaraSystem*> BatchedSystemsWithRecords;
+
+	/* 기록을 시스템별로 모으는 임시 배열 (매 프레임 재사용) */
+	TMap<UNiagaraSystem*, TArray<FVector>> BatchedPositions;
+
+	/* 이번 프레임 통계 */
+	int32 NumRequested = 0;
+	int32 NumMerged = 0;
+};
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "WeaponTraceSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * 무기 박스 트레이스를 프레임 단위로 모아 비동기 물리 쿼리로 처리하는 서브시스템
+ * 1. 이번 프레임 동안 겹침이 발생한 무기를 모음 (무기당 한 번)
+ * 2. 서브시스템 틱에서 모아둔 요청을 AsyncSweepByChannel 로 제출
+ * 3. 다음 프레임 틱에서 결과를 받아 무기가 데미지 이벤트를 UDamageQueueSubsystem 에 넣음
+ *
+ * 스윕 모드(bUseSweptTrace) 무기는 겹침 대신 휘두르기 구간(노티파이 창) 동안 매 프레임
+ * 이전 프레임 칼날에서 이번 프레임 칼날까지를 몇 구간으로 나눠, 구간마다 칼날 길이의 박스를 스윕합니다. (AWeapon::SubmitBladeSweep)
+ * 구간 수는 칼날의 회전량에 따라 정해지므로 낮은 프레임에서도 궤적 사이가 비지 않고 높은 프레임에서는 한 번만 트레이스합니다.
+ * MaxSweepSubsteps 에 걸릴 만큼 빠른 휘두르기는 구간마다 회전각이 커져 박스 방향 근사의 빈틈도 커집니다.
+ *
+ * 결과는 제출 당시의 휘두르기 번호와 함께 보관하고, 그 사이 새 휘두르기가 시작된 무기의 결과는 버립니다.
+ */
+UCLASS()
+class SLASH_API UWeaponTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 이번 프레임에 무기의 박스 트레이스를 예약합니다. 같은 프레임의 중복 요청은 하나로 합쳐집니다.
+	 * @param Weapon 트레이스할 무기
+	 */
+	void QueueBoxTrace(AWeapon* Weapon);
+
+	/**
+	 * 휘두르기 구간을 시작합니다. 지금 칼날 위치를 첫 샘플로 기록합니다.
+	 * @param Weapon 스윕 모드 무기
+	 */
+	void BeginSwing(AWeapon* Weapon);
+
+	/**
+	 * 휘두르기 구간을 끝냅니다.
+	 * @param Weapon 스윕 모드 무기
+	 */
+	void EndSwing(AWeapon* Weapon);
+
+private:
+	struct FInFlightTrace
+	{
+		TWeakObjectPtr<AWeapon> Weapon;
+		FTraceHandle Handle;
+		uint32 SwingId = 0;
+	};
+
+	/* 휘두르는 중인 무기와 지난 프레임의 칼날 위치 */
+	struct FActiveSwing
+	{
+		TWeakObjectPtr<AWeapon> Weapon;
+		FVector PreviousStart = FVector::ZeroVector;
+		FVector PreviousEnd = FVector::ZeroVector;
+		FQuat PreviousRotation = FQuat::Identity;
+	};
+
+	void ResolveInFlightTraces();
+	void SubmitQueuedTraces();
+	void SubmitSweptTraces();
+
+	/* 이번 프레임에 트레이스를 요청한 무기 */
+	TArray<TWeakObjectPtr<AWeapon>> QueuedWeapons;
+
+	/* 지난 프레임에 제출해 결과를 기다리는 트레이스 */
+	TArray<FInFlightTrace> InFlightTraces;
+
+	TArray<FActiveSwing> ActiveSwings;
+};
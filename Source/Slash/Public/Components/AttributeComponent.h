@@ -6,21 +6,51 @@
 #include "Components/ActorComponent.h"
 #include "AttributeComponent.generated.h"
 
+class UAttributeStoreSubsystem;
 
+/**
+ * 변경된 속성 종류
+ */
+enum class EAttributeType : uint8
+{
+	EAT_Health,
+	EAT_Stamina,
+	EAT_Gold,
+	EAT_Souls
+};
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnAttributeChanged, class UAttributeComponent*, EAttributeType);
+
+/**
+ * 캐릭터 속성의 핸들
+ * 아래 값들은 에디터에서 설정하는 초기값이며, 플레이 중 실제 값은 UAttributeStoreSubsystem 의 SoA 배열에 있습니다.
+ * BeginPlay 에서 저장소에 등록되고 EndPlay 에서 현재 값을 되돌려 받은 뒤 해제됩니다.
+ * 등록되지 않은 동안(저장소가 없는 월드 포함)에는 읽기/쓰기 모두 아래 값을 직접 사용합니다.
+ */
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class SLASH_API UAttributeComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
-public:	
+public:
 	UAttributeComponent();
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-	void RegenStamina(float DeltaTime);
+
+	/* 저장소의 스태미나 회복 루프에 참여할지 여부 (플레이어만 회복) */
+	FORCEINLINE void SetRegenerateStamina(bool bRegenerate) { bRegenerateStamina = bRegenerate; }
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	friend class UAttributeStoreSubsystem;
+
+	FORCEINLINE bool HasStoreHandle() const { return Store != nullptr && StoreIndex != INDEX_NONE; }
+
+	/* 저장소 핸들이 없을 때 컴포넌트의 값을 바꾸고, 바뀌었으면 OnAttributeChanged 를 호출 */
+	void SetLocalHealth(float NewHealth);
+	void SetLocalStamina(float NewStamina);
+
 	/* 현재 체력 */
 	UPROPERTY(EditAnywhere, Category = "액터 속성")
 	float Health;
@@ -49,6 +79,14 @@ private:
 	UPROPERTY(EditAnywhere, Category = "액터 속성")
 	float StaminaRegenRate = 8.f;
 
+	UPROPERTY(EditAnywhere, Category = "액터 속성")
+	bool bRegenerateStamina = false;
+
+	UPROPERTY(Transient)
+	UAttributeStoreSubsystem* Store;
+
+	/* 저장소 배열에서의 위치, 등록되지 않았으면 INDEX_NONE */
+	int32 StoreIndex = INDEX_NONE;
 
 public:
 	void ReceiveDamage(float Damage);
@@ -60,11 +98,17 @@ public:
 	void AddSouls(int32 NumberOfSouls);
 	void AddHealPotion(int32 NumberOfHealPotion);
 
-	FORCEINLINE int32 GetGold() const { return Gold; }
-	FORCEINLINE int32 GetSouls() const { return Souls; }
-	FORCEINLINE int32 GetHealPotion() const { return Souls; }
+	/* 체력/스태미나를 최대치로 되돌립니다. (풀에서 재사용될 때) */
+	void ResetAttributes();
+
+	int32 GetGold() const;
+	int32 GetSouls() const;
+	FORCEINLINE int32 GetHealPotion() const { return GetSouls(); }
 	FORCEINLINE float GetDodgeConst() const { return DodgeConst; }
 	FORCEINLINE float GetAttackStamina() const { return AttackConst; }
-	FORCEINLINE float GetStamina() const { return Stamina; }
-	
+	float GetStamina() const;
+	float GetHealth() const;
+
+	/* 값이 실제로 바뀌었을 때만 호출 (HUD 등 구독자는 폴링 대신 이 이벤트를 사용) */
+	FOnAttributeChanged OnAttributeChanged;
 };
@@ -0,0 +1,74 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AttributeStoreSubsystem.generated.h"
+
+class UAttributeComponent;
+
+/**
+ * 모든 전투원의 속성(체력/스태미나/골드/영혼)을 SoA 배열로 보관하는 월드 서브시스템
+ * UAttributeComponent 는 이 저장소의 인덱스(핸들)만 들고 있고, 읽기/쓰기는 모두 여기로 전달됩니다.
+ * 스태미나 회복과 생존 집계는 매 프레임 전체 배열을 한 번에 훑는 루프로 처리합니다. (ASlashCharacter::Tick 대체)
+ */
+UCLASS()
+class SLASH_API UAttributeStoreSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 컴포넌트에 설정된 초기값으로 저장소에 자리를 만들고 핸들을 부여합니다.
+	 * @param Component 등록할 속성 컴포넌트
+	 */
+	void RegisterAttributes(UAttributeComponent* Component);
+
+	/**
+	 * 현재 값을 컴포넌트에 되돌려 쓰고 저장소에서 제거합니다.
+	 * @param Component 해제할 속성 컴포넌트
+	 */
+	void UnregisterAttributes(UAttributeComponent* Component);
+
+	FORCEINLINE float GetHealth(int32 Index) const { return Health[Index]; }
+	FORCEINLINE float GetMaxHealth(int32 Index) const { return MaxHealth[Index]; }
+	FORCEINLINE float GetStamina(int32 Index) const { return Stamina[Index]; }
+	FORCEINLINE float GetMaxStamina(int32 Index) const { return MaxStamina[Index]; }
+	FORCEINLINE int32 GetGold(int32 Index) const { return Gold[Index]; }
+	FORCEINLINE int32 GetSouls(int32 Index) const { return Souls[Index]; }
+
+	/* 값이 바뀌었으면 컴포넌트의 OnAttributeChanged 를 호출 */
+	void SetHealth(int32 Index, float NewHealth);
+	void SetStamina(int32 Index, float NewStamina);
+	void AddGold(int32 Index, int32 NumberOfGold);
+	void AddSouls(int32 Index, int32 NumberOfSouls);
+
+	FORCEINLINE int32 GetNumCombatants() const { return Components.Num(); }
+
+private:
+	UPROPERTY()
+	TArray<UAttributeComponent*> Components;
+
+	/* Components 와 같은 인덱스를 쓰는 SoA 배열 */
+	TArray<float> Health;
+	TArray<float> MaxHealth;
+	TArray<float> Stamina;
+	TArray<float> MaxStamina;
+	TArray<float> StaminaRegenRate;
+	TArray<int32> Gold;
+	TArray<int32> Souls;
+
+	/* 회복 루프에서 값이 바뀐 인덱스 (전투원 수만큼 잡아 두고 앞쪽 바뀐 개수만 유효, 매 프레임 재사용) */
+	TArray<int32> ChangedStamina;
+};
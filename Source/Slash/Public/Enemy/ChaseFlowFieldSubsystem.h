@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ChaseFlowFieldSubsystem.generated.h"
+
+class AEnemy;
+class ANavigationData;
+
+/**
+ * 같은 대상을 추격하는 적들이 함께 쓰는 흐름장(Flow Field) 서브시스템
+ * 적마다 A* 경로를 찾는 대신 대상 주변 격자 한 장에 대상까지의 비용을 한 번 계산해 두고,
+ * 추격 중인 적은 자기 칸의 방향을 O(1) 로 읽어 이동 입력으로 사용합니다.
+ *
+ * 1. 대상이 다른 칸으로 옮겨 갔을 때만 격자를 대상 중심으로 다시 맞추고 비용/방향을 다시 계산 (O(격자))
+ * 2. 칸의 내비메시 통과 여부는 월드 칸 좌표로 캐시해서 새로 격자에 들어온 칸만 투영
+ * 3. 방향에 공간 해시로 찾은 주변 적과의 분리(Separation) 벡터를 더해 뭉치지 않게 함
+ * 격자를 벗어나거나 도달할 수 없는 칸에 있는 적은 흐름장에서 빠지고 일반 경로 이동(MoveToTarget)으로 돌아갑니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UChaseFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 적을 흐름장 추격에 참여시킵니다.
+	 * 흐름장이 다른 대상을 위해 쓰이는 중이거나 적이 격자 밖/도달 불가 칸에 있으면 실패합니다.
+	 * @param Enemy 추격할 적
+	 * @param Target 추격 대상
+	 * @return 참여했으면 true (호출자는 경로 이동을 멈춰야 함)
+	 */
+	bool AddChaser(AEnemy* Enemy, AActor* Target);
+
+	/**
+	 * 위치에서 대상까지 내려가는 방향(XY, 단위 벡터)을 읽습니다.
+	 * @return 격자 안의 도달 가능한 칸이면 true
+	 */
+	bool SampleDirection(const FVector& Location, FVector& OutDirection) const;
+
+	FORCEINLINE int32 GetNumChasers() const { return Chasers.Num(); }
+
+private:
+	/* 격자 한 변의 칸 수 */
+	FORCEINLINE int32 GetGridSize() const { return HalfExtentCells * 2 + 1; }
+
+	FIntPoint WorldToCell(const FVector& Location) const;
+
+	/* 월드 칸 좌표 → 격자 인덱스, 격자 밖이면 INDEX_NONE */
+	int32 CellToIndex(const FIntPoint& Cell) const;
+
+	/* 대상 칸을 중심으로 격자를 다시 맞추고 비용/방향을 계산 */
+	void RebuildField(const FVector& TargetLocation);
+
+	/* 칸의 내비메시 통과 여부 (캐시 우선, 투영 높이 구간별로 따로 저장해 여러 층을 구분) */
+	bool IsCellWalkable(const FIntPoint& Cell, double ProbeZ);
+
+	/* 내비메시가 다시 만들어지면 통과 여부 캐시와 흐름장을 버림 */
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	/* 흐름장 방향 + 분리 벡터로 이동 입력을 넣습니다. */
+	void SteerChasers();
+
+	/* 흐름장에서 빼고 일반 경로 이동으로 되돌립니다. */
+	void FallBackToPath(AEnemy* Enemy);
+
+	/* 칸 크기(cm) */
+	UPROPERTY(Config)
+	float CellSize = 100.f;
+
+	/* 대상에서 격자 끝까지의 칸 수 (격자 한 변 = 2 * HalfExtentCells + 1) */
+	UPROPERTY(Config)
+	int32 HalfExtentCells = 30;
+
+	/* 칸 중심을 내비메시로 투영할 때의 높이 허용 범위 */
+	UPROPERTY(Config)
+	float ProjectionHeight = 200.f;
+
+	/* 이 거리 안의 다른 적에게서 멀어지려는 힘을 더함 */
+	UPROPERTY(Config)
+	float SeparationRadius = 150.f;
+
+	UPROPERTY(Config)
+	float SeparationWeight = 1.f;
+
+	TWeakObjectPtr<AActor> FieldTarget;
+	TArray<TWeakObjectPtr<AEnemy>> Chasers;
+
+	/* 격자 중심(대상) 칸의 월드 칸 좌표 */
+	FIntPoint FieldOrigin = FIntPoint(MAX_int32, MAX_int32);
+	bool bFieldValid = false;
+
+	/* 격자 배열 (인덱스 = Y * GridSize + X) */
+	TArray<int32> IntegrationCost;
+	TArray<FVector2f> FlowDirections;
+
+	/* (월드 칸 X, Y, 투영 높이 구간) → 통과 가능 여부 */
+	TMap<FIntVector, bool> WalkableCache;
+
+	/* 분리 계산용 (매 적마다 재사용) */
+	TArray<AActor*> NearbyActors;
+};
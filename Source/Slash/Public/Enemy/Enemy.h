@@ -5,22 +5,38 @@
 #include "CoreMinimal.h"
 #include "Characters/CharacterType.h"
 #include "Characters/BaseCharacter.h"
+#include "Interface/PoolableInterface.h"
 #include "Enemy.generated.h"
 
 class UBoxComponent;
 class UHealthBarComponent;
-class UPawnSensingComponent;
+class USightQueryComponent;
+struct FPatrolCrowdProxyState;
+
+/**
+ * 전투 대상과의 거리 구간 (업데이트마다 한 번만 계산)
+ */
+enum class ECombatTargetRange : uint8
+{
+	/* AttackRadius 안 */
+	ECTR_InsideAttack,
+
+	/* AttackRadius 밖, CombatRadius 안 */
+	ECTR_InsideCombat,
+
+	/* CombatRadius 밖 또는 대상 없음 */
+	ECTR_OutsideCombat
+};
 
 UCLASS()
-class SLASH_API AEnemy : public ABaseCharacter
+class SLASH_API AEnemy : public ABaseCharacter, public IPoolableInterface
 {
 	GENERATED_BODY()
 
 public:
-	AEnemy();
+	AEnemy(const FObjectInitializer& ObjectInitializer);
 
 	/* <AActor> */
-	virtual void Tick(float DeltaTime) override;
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 	virtual void Destroyed() override;
 	/* </AActor> */
@@ -29,9 +45,69 @@ public:
 	virtual void GetHit_Implementation(const FVector& ImpactPoint, AActor* Hitter) override;
 	/* </IHitInterFace> */
 
+	/* <IPoolableInterface> */
+	virtual void Activate() override;
+	virtual void Deactivate() override;
+	/* </IPoolableInterface> */
+
+	/**
+	 * 풀에서 꺼낸 적에게 새 순찰 경로를 지정합니다. 순찰 중이면 바로 새 지점으로 이동합니다.
+	 * @param NewPatrolTargets 순찰 지점 목록
+	 * @param NewPatrolTarget 처음 이동할 순찰 지점
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Patrol")
+	void SetPatrolTargets(const TArray<AActor*>& NewPatrolTargets, AActor* NewPatrolTarget);
+
+	/**
+	 * 전투/순찰 대상을 확인하고 AI 의 행동을 결정합니다.
+	 * UEnemyAIManager 가 매 프레임 등록된 모든 적에 대해 일괄 호출합니다.
+	 * @param DeltaTime 프레임 간 경과 시간
+	 */
+	void UpdateAI(float DeltaTime);
+
+	/**
+	 * 순찰보다 높은 상태(추격/공격/전투중)인지 여부를 판단합니다.
+	 * @return 전투 관련 상태인지 여부
+	 */
+	FORCEINLINE bool IsInCombat() const { return EnemyState > EEnemyState::EES_Patrolling; }
+
+	FORCEINLINE EEnemyState GetEnemyState() const { return EnemyState; }
+	FORCEINLINE class APatrolRouteGraph* GetPatrolRoute() const { return PatrolRoute; }
+	FORCEINLINE const TArray<AActor*>& GetPatrolTargets() const { return PatrolTargets; }
+
+	/* 흐름장 추격에서 이동 입력을 멈출 대상과의 3D 거리 (공격 반경 안쪽으로 도착 허용 반경만큼) */
+	FORCEINLINE double GetChaseStopDistance() const { return FMath::Max(AttackRadius - AcceptanceRadius, 0.0); }
+
+	/* 프록시로 대신할 때 쓸 메시 (없으면 강등되지 않음) */
+	FORCEINLINE class UStaticMesh* GetCrowdProxyMesh() const { return CrowdProxyMesh; }
+
+	/* 플레이어를 알아챌 수 있는 거리 (시야 반경과 CombatRadius 중 큰 값) */
+	double GetDetectionRadius() const;
+
+	/**
+	 * 프록시로 강등할 때 순찰 상태를 꺼냅니다. (UPatrolCrowdSubsystem)
+	 * @param OutState 순찰 지점/그래프 구간/순찰 속도/대기 범위/체력 (승격 거리는 호출자가 채움)
+	 * @return 순찰 지점에서 대기 중이면 남은 대기 시간, 이동 중이면 0
+	 */
+	float GetPatrolState(FPatrolCrowdProxyState& OutState) const;
+
+	/**
+	 * 프록시에서 승격된 직후 순찰 상태와 체력을 되돌리고 순찰을 이어갑니다.
+	 * 풀에서 꺼낼 때 예전 목표로 보낸 이동 요청을 덮어씁니다.
+	 * @param State GetPatrolState 로 꺼낸 뒤 프록시가 갱신한 상태
+	 * @param WaitRemaining 0 보다 크면 그 시간 뒤 순찰 타이머로 다음 지점에 출발, 아니면 바로 이동
+	 */
+	void ApplyPatrolState(const FPatrolCrowdProxyState& State, float WaitRemaining);
+
+	/**
+	 * 흐름장을 쓸 수 없을 때 전투 대상까지 일반 경로 이동으로 추격합니다. (UChaseFlowFieldSubsystem 이 호출)
+	 */
+	void ChaseAlongPath();
+
 protected:
 	/* <AActor> */
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	/* </AActor> */
 
 	/* <ABaseCharacter> */
@@ -43,6 +119,21 @@ protected:
 	/* </ABaseCharacter> */
 	
 	void SpawnSoul();
+	void UnregisterFromAIManager();
+
+	/* UPatrolCrowdSubsystem 의 강등 후보에 등록/제거 */
+	void RegisterWithCrowd();
+	void UnregisterFromCrowd();
+
+	/**
+	 * 사망 후 DeathLifeSpan 이 지나면 호출됩니다. 풀로 돌아가고, 풀이 없으면 파괴합니다.
+	 */
+	void ReturnToPool();
+
+	/**
+	 * AI 매니저에서 최고 등급으로 승격시켜 다음 업데이트에 즉시 판단하게 합니다.
+	 */
+	void PromoteAIUpdate();
 	void ActivateArmCollision(bool bActivate);
 
 	UPROPERTY(BlueprintReadOnly)
@@ -152,20 +243,42 @@ private:
 	 * 현재 실행 중인 공격 타이머를 취소합니다.
 	 */
 	void ClearAttackTimer();
+
+	/**
+	 * 전투 대상과의 제곱 거리를 한 번 계산해 CombatTargetRange 에 저장합니다.
+	 * IsOutsideCombatRadius / IsOutsideAttackRadius / IsInsideAttackRadius 는 이 결과를 읽습니다.
+	 */
+	void ClassifyCombatTarget();
+
+	/**
+	 * 순찰 중이거나 플레이어 화면 밖(OffscreenMovementDelay 초 동안 렌더링되지 않음)이면 간이 이동(내비메시 투영),
+	 * 추격/공격 중이거나 bAllowSimplifiedMovement 가 꺼져 있으면 전체 걷기 물리를 쓰도록 이동 모드를 맞춥니다.
+	 */
+	void UpdateMovementMode();
+
 	bool InTargetRange(AActor* Target, double Radius);
 	void MoveToTarget(AActor* Target);
+
+	/* UPathRequestSubsystem 에 대기/탐색 중인 이동 요청을 취소 (사망, 풀 반환, 파괴) */
+	void CancelPathRequest();
 	AActor* ChoosePatrolTarget();
 
+	/* 그래프에서 PatrolTarget 의 지점 인덱스를 다시 찾습니다. */
+	void ResolvePatrolWaypoint();
+
+	/* 구운 구간 경로로 다음 지점까지 이동 (경로 탐색 없음), 구운 경로가 없으면 MoveToTarget */
+	void FollowPatrolLeg();
+
 	bool ActorsSameType(AActor* OtherActor);
 
 	UFUNCTION()
-	void PawnSeen(APawn* SeenPawn); // callback OnPawnSeen in UPanwSensingComponent
+	void PawnSeen(APawn* SeenPawn); // callback OnSeePawn in USightQueryComponent
 
 	UPROPERTY(VisibleAnywhere)
 	class UHealthBarComponent* HealthBarWidget;
 
 	UPROPERTY(VisibleAnywhere)
-	UPawnSensingComponent* PawnSensing;
+	USightQueryComponent* SightQuery;
 
 	UPROPERTY(EditAnywhere)
 	TSubclassOf<class AWeapon> WeaponClass;
@@ -176,12 +289,23 @@ private:
 	UPROPERTY(EditAnywhere)
 	double AttackRadius = 150.f;
 
+	/* 마지막으로 분류한 전투 대상과의 거리 구간 */
+	ECombatTargetRange CombatTargetRange = ECombatTargetRange::ECTR_OutsideCombat;
+
 	UPROPERTY(EditInstanceOnly, Category = "AI Navigation")
 	AActor* PatrolTarget;
 
 	UPROPERTY(EditInstanceOnly, Category = "AI Navigation")
 	TArray<AActor*> PatrolTargets;
 
+	/* 지정하면 PatrolTargets 대신 그래프의 구간/구운 경로로 순찰 (PatrolTarget 은 그래프의 지점이어야 함) */
+	UPROPERTY(EditInstanceOnly, Category = "AI Navigation")
+	class APatrolRouteGraph* PatrolRoute;
+
+	/* PatrolTarget 의 그래프 지점 인덱스와 지금 걷는 구간 (그래프가 없으면 INDEX_NONE) */
+	int32 PatrolWaypointIndex = INDEX_NONE;
+	int32 PatrolLegIndex = INDEX_NONE;
+
 	UPROPERTY(EditAnywhere)
 	double PatrolRadius = 200.f;
 
@@ -199,12 +323,22 @@ private:
 	UPROPERTY(EditAnywhere, Category = Combat)
 	double AcceptanceRadius = 50.f;
 
+	/* 순찰 중이거나 화면 밖일 때 간이 이동(UEnemyMovementComponent)을 허용 (끄면 항상 전체 걷기 물리) */
+	UPROPERTY(EditAnywhere, Category = "AI Navigation")
+	bool bAllowSimplifiedMovement = true;
+
+	/* 이 시간(초) 동안 렌더링되지 않으면 화면 밖으로 보고 간이 이동으로 전환 */
+	UPROPERTY(EditAnywhere, Category = "AI Navigation", meta = (EditCondition = "bAllowSimplifiedMovement", ClampMin = "0.0"))
+	float OffscreenMovementDelay = 0.5f;
+
 
 	UPROPERTY()
 	class AAIController* EnemyController;
 	
 	FTimerHandle AttackTimer;
 
+	FTimerHandle DeathTimer;
+
 	UPROPERTY(EditAnywhere, Category = Combat)
 	float AttackMin = 0.5f;
 	
@@ -214,9 +348,17 @@ private:
 	UPROPERTY(EditAnywhere, Category = Combat)
 	float ChasingSpeed = 300.f;
 
+	/* 사망 후 풀로 돌아가기까지의 시간 */
 	UPROPERTY(EditAnywhere, Category = Combat)
 	float DeathLifeSpan = 8.f;
 
 	UPROPERTY(EditAnywhere, Category = Combat)
 	TSubclassOf<class ASoul> SoulClass;
+
+	/**
+	 * 플레이어와 멀리서 순찰할 때 대신 그려질 스태틱 메시 (스켈레탈 메시와 같은 원점/방향, 버텍스 애니메이션 머티리얼 가능)
+	 * 지정하지 않으면 이 적은 프록시로 강등되지 않습니다.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Crowd")
+	class UStaticMesh* CrowdProxyMesh;
 };
@@ -0,0 +1,141 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EnemyAIManager.generated.h"
+
+class AEnemy;
+
+/**
+ * 플레이어와의 거리에 따른 AI 업데이트 등급
+ */
+USTRUCT()
+struct FEnemyAISignificanceTier
+{
+	GENERATED_BODY()
+
+	/* 이 등급이 적용되는 최대 거리 (플레이어 기준) */
+	UPROPERTY(Config)
+	float MaxDistance = 0.f;
+
+	/* 판단 주기(초), 0 이면 매 프레임 */
+	UPROPERTY(Config)
+	float UpdateInterval = 0.f;
+
+	/* 애니메이션 업데이트/평가 주기(프레임), 1 이면 매 프레임, 건너뛴 프레임은 보간 */
+	UPROPERTY(Config)
+	int32 AnimUpdateRate = 1;
+};
+
+/**
+ * 적 한 명의 업데이트 예약 상태
+ */
+struct FEnemyAIUpdateState
+{
+	/* 마지막 판단 이후 누적된 시간 */
+	float TimeSinceUpdate = 0.f;
+
+	/* 현재 적용 중인 등급 인덱스 */
+	int32 Tier = 0;
+
+	/* 메시에 마지막으로 적용한 애니메이션 업데이트 주기 (0 = 아직 적용 안 함) */
+	int32 AnimUpdateRate = 0;
+
+	/* 피격/발견 등으로 다음 프레임에 즉시 판단해야 하는지 여부 */
+	bool bPromoted = false;
+};
+
+/**
+ * 월드에 살아있는 모든 AEnemy 의 순찰/전투 판단을 한 번의 일괄 처리로 갱신하는 매니저
+ * AEnemy::Tick 대신 이 서브시스템이 매 프레임 등록된 적들의 AI 를 업데이트합니다.
+ *
+ * 적은 플레이어와의 거리/화면 노출 여부로 등급(SignificanceTiers)이 나뉘고, 등급마다 판단 주기가 다릅니다.
+ * 전투 중이거나 승격(PromoteToFullRate)된 적은 항상 매 프레임 판단하고,
+ * 나머지는 MaxUpdateMilliseconds 예산 안에서 라운드 로빈으로 나눠 처리합니다.
+ *
+ * 같은 등급으로 메시의 애니메이션 업데이트 주기(URO)도 정합니다. 전투 중인 적은 항상 매 프레임입니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UEnemyAIManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 적을 일괄 업데이트 대상으로 등록합니다.
+	 * @param Enemy 등록할 적
+	 */
+	void RegisterEnemy(AEnemy* Enemy);
+
+	/**
+	 * 적을 일괄 업데이트 대상에서 제거합니다. (사망, 파괴 시)
+	 * @param Enemy 제거할 적
+	 */
+	void UnregisterEnemy(AEnemy* Enemy);
+
+	/**
+	 * 적을 최고 등급으로 올려 다음 업데이트에서 예산과 무관하게 즉시 판단하게 합니다.
+	 * 피격되거나 플레이어를 발견했을 때 호출합니다.
+	 * @param Enemy 승격할 적
+	 */
+	void PromoteToFullRate(AEnemy* Enemy);
+
+	FORCEINLINE int32 GetNumEnemies() const { return Enemies.Num(); }
+
+private:
+	/* 업데이트 도중 제거된 빈 슬롯을 정리 */
+	void CompactEnemies();
+
+	/**
+	 * 플레이어와의 거리와 화면 노출 여부로 적의 등급을 계산합니다.
+	 * @return SignificanceTiers 인덱스 (0 = 최고 등급)
+	 */
+	int32 ComputeTier(const AEnemy* Enemy, const FVector& ViewLocation, bool bHasViewLocation) const;
+
+	float GetTierInterval(int32 Tier) const;
+	int32 GetTierAnimUpdateRate(int32 Tier) const;
+
+	/**
+	 * 등급에 맞는 애니메이션 업데이트 주기를 메시에 적용합니다. 바뀌었을 때만 메시를 건드립니다.
+	 */
+	void ApplyAnimUpdateRate(AEnemy* Enemy, FEnemyAIUpdateState& State, int32 AnimUpdateRate) const;
+
+	/* 등록된 적 목록 (업데이트 순서 = 등록 순서) */
+	UPROPERTY()
+	TArray<AEnemy*> Enemies;
+
+	/* Enemies 와 같은 인덱스를 쓰는 업데이트 예약 상태 */
+	TArray<FEnemyAIUpdateState> UpdateStates;
+
+	/* 가까운 순서대로 정렬된 등급 목록, 어느 등급에도 속하지 않으면 마지막 등급 */
+	UPROPERTY(Config)
+	TArray<FEnemyAISignificanceTier> SignificanceTiers;
+
+	/* 화면에 보이지 않는 적에게 더할 등급 수 */
+	UPROPERTY(Config)
+	int32 OffscreenTierPenalty = 1;
+
+	/* 최고 등급이 아닌 적의 판단에 한 프레임 동안 쓸 수 있는 최대 시간(ms) */
+	UPROPERTY(Config)
+	float MaxUpdateMilliseconds = 1.f;
+
+	/* 예산 초과로 다음 프레임에 이어서 처리할 위치 */
+	int32 RoundRobinCursor = 0;
+
+	/* 일괄 업데이트 중인지 여부 (업데이트 도중 제거 시 슬롯만 비움) */
+	bool bIsUpdating = false;
+
+	bool bNeedsCompaction = false;
+};
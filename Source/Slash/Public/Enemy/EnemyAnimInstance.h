@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "Characters/CharacterType.h"
+#include "EnemyAnimInstance.generated.h"
+
+/**
+ * 게임 스레드에서 한 번에 복사해 두는 적 상태
+ */
+struct FEnemyAnimSnapshot
+{
+	FVector Velocity = FVector::ZeroVector;
+	bool bIsFalling = false;
+	EEnemyState EnemyState = EEnemyState::EES_Patrolling;
+	TEnumAsByte<EDeathPose> DeathPose;
+};
+
+/**
+ * 적 전용 애님 인스턴스
+ * USlashAnimInstance 와 같이 게임 스레드에서는 상태 복사만 하고 계산은 워커 스레드에서 합니다.
+ * 업데이트/평가 주기는 UEnemyAIManager 가 거리 등급에 따라 메시에 설정합니다.
+ */
+UCLASS()
+class SLASH_API UEnemyAnimInstance : public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NativeInitializeAnimation() override;
+
+	/* 게임 스레드: 적 상태를 Snapshot 에 복사만 함 */
+	virtual void NativeUpdateAnimation(float DeltaTime) override;
+
+	/* 워커 스레드: Snapshot 으로 애님 그래프 변수 계산 */
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaTime) override;
+
+	UPROPERTY(BlueprintReadOnly)
+	class AEnemy* Enemy;
+
+	UPROPERTY(BlueprintReadOnly, Category = Movement)
+	class UCharacterMovementComponent* EnemyMovement;
+
+	UPROPERTY(BlueprintReadOnly, Category = Movement)
+	float GroundSpeed;
+
+	UPROPERTY(BlueprintReadOnly, Category = Movement)
+	bool IsFalling;
+
+	UPROPERTY(BlueprintReadOnly, Category = Movement)
+	EEnemyState EnemyState;
+
+	UPROPERTY(BlueprintReadOnly, Category = Movement)
+	TEnumAsByte<EDeathPose> DeathPose;
+
+private:
+	FEnemyAnimSnapshot Snapshot;
+};
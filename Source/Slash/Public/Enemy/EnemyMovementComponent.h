@@ -0,0 +1,42 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "EnemyMovementComponent.generated.h"
+
+/**
+ * 적 전용 이동 컴포넌트
+ * 순찰 중이거나 플레이어 화면 밖에서는 바닥 찾기/계단 오르기를 하는 걷기(MOVE_Walking) 대신
+ * 내비메시에 위치를 투영하는 간이 이동(MOVE_NavWalking)을 쓰고, 추격/공격 중에는 다시 전체 걷기 물리로 돌아갑니다. (AEnemy::UpdateMovementMode)
+ * 간이 이동도 충돌 스윕은 그대로 하므로 아끼는 것은 바닥 찾기/계단 오르기 비용입니다.
+ * 모드별 틱 시간과 적 수는 stat SlashAI 로 확인합니다.
+ */
+UCLASS()
+class SLASH_API UEnemyMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyMovementComponent();
+
+	/* <UActorComponent> */
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	/* </UActorComponent> */
+
+	/**
+	 * 간이 이동 모드를 켜거나 끕니다. 걷기/간이 이동 중일 때만 전환합니다. (낙하 중에는 착지 후 다음 호출에서)
+	 * 내비 데이터가 없으면 켜지 않습니다.
+	 * @param bEnable true 면 MOVE_NavWalking, false 면 MOVE_Walking
+	 */
+	void SetSimplifiedMovement(bool bEnable);
+
+	FORCEINLINE bool IsSimplifiedMovement() const { return MovementMode == MOVE_NavWalking; }
+
+protected:
+	/* <UCharacterMovementComponent> */
+	virtual void PhysWalking(float DeltaTime, int32 Iterations) override;
+	virtual void PhysNavWalking(float DeltaTime, int32 Iterations) override;
+	/* </UCharacterMovementComponent> */
+};
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "EnemyPerceptionSubsystem.generated.h"
+
+class USightQueryComponent;
+
+/**
+ * 모든 USightQueryComponent 의 시야 요청을 모아 한 프레임에 한 번 처리하는 감지 서비스
+ * 1. 주기가 된 감지기만 모아 거리/시야각 판정을 배열 단위로 한 번에 계산
+ * 2. 통과한 (감지기, 플레이어) 쌍만 비동기 라인 트레이스(AsyncLineTraceByChannel)로 가림 여부 확인
+ * 3. 다음 프레임에 결과가 오면 보인 Pawn 을 감지기의 OnSeePawn 으로 전달
+ */
+UCLASS()
+class SLASH_API UEnemyPerceptionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	void RegisterSensor(USightQueryComponent* Sensor);
+	void UnregisterSensor(USightQueryComponent* Sensor);
+
+private:
+	/* 비동기 트레이스 결과를 기다리는 (감지기, 대상) 쌍 */
+	struct FPendingSightTrace
+	{
+		TWeakObjectPtr<USightQueryComponent> Sensor;
+		TWeakObjectPtr<APawn> Target;
+		FTraceHandle Handle;
+	};
+
+	void GatherTargets();
+	void CullSightRequests();
+	void SubmitSightTraces();
+	void OnSightTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/* 등록된 감지기와 각자의 다음 판정까지 남은 시간 */
+	UPROPERTY()
+	TArray<USightQueryComponent*> Sensors;
+	TArray<float> TimeUntilSense;
+
+	/* 이번 프레임에 판정할 감지기 (SoA) */
+	TArray<int32> DueSensors;
+	TArray<float> EyeX, EyeY, EyeZ;
+	TArray<float> DirX, DirY, DirZ;
+	TArray<float> RadiusSquared;
+	TArray<float> VisionCosine;
+
+	/* 시야 판정 대상 (플레이어 Pawn) */
+	TArray<APawn*> Targets;
+
+	/* 거리/시야각 판정 결과, DueSensors.Num() * Targets.Num() */
+	TArray<uint8> Survivors;
+
+	TArray<FPendingSightTrace> PendingTraces;
+	FTraceDelegate SightTraceDelegate;
+};
@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "PathRequestSubsystem.generated.h"
+
+class AAIController;
+
+/**
+ * 적 이동 요청(AEnemy::MoveToTarget)의 경로 탐색을 모아서 비동기로 처리하는 서브시스템
+ * 1. 같은 컨트롤러가 같은 목표로 이미 대기/탐색/이동 중이면 새 요청은 버림 (연타 피격 시 ChaseTarget 반복 등)
+ * 2. 목표가 바뀌면 대기 중인 요청을 갱신하고, 탐색 중인 결과는 도착해도 버림
+ * 3. 틱마다 대기열 앞에서부터 MaxQueriesPerFrame 개만 FindPathAsync 로 제출
+ * 4. 결과가 오면 경로를 그대로 RequestMove 에 넘겨 이동 시작 (목표 액터 추적 포함)
+ */
+UCLASS(Config = Game)
+class SLASH_API UPathRequestSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 목표 액터로의 이동을 예약합니다.
+	 * @param Controller 이동할 AI 컨트롤러
+	 * @param Goal 목표 액터
+	 * @param AcceptanceRadius 도착으로 간주할 거리
+	 */
+	void RequestMove(AAIController* Controller, AActor* Goal, float AcceptanceRadius);
+
+	/**
+	 * 컨트롤러의 대기/탐색 중인 요청을 취소합니다. (이동 정지, 풀 반환, 파괴)
+	 */
+	void CancelRequest(AAIController* Controller);
+
+private:
+	struct FPathRequest
+	{
+		TWeakObjectPtr<AActor> Goal;
+		float AcceptanceRadius = 0.f;
+
+		/* 요청 시각 (지연 시간 통계용) */
+		double RequestTime = 0.0;
+
+		/* 탐색 중인 쿼리 ID, 대기 중이면 INVALID_NAVQUERYID */
+		uint32 QueryId = INVALID_NAVQUERYID;
+	};
+
+	/* 컨트롤러가 이미 Goal 로 경로를 따라 이동 중인지 */
+	static bool IsMovingToGoal(const AAIController* Controller, const AActor* Goal);
+
+	void SubmitPendingRequests();
+
+	/* FindPathAsync 완료 콜백 (게임 스레드) */
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	/* 프레임당 최대 경로 탐색 제출 수 */
+	UPROPERTY(Config)
+	int32 MaxQueriesPerFrame = 8;
+
+	/* 컨트롤러별 대기/탐색 중인 요청 (컨트롤러당 하나) */
+	TMap<TWeakObjectPtr<AAIController>, FPathRequest> Requests;
+
+	/* 제출을 기다리는 컨트롤러 (요청 순서) */
+	TArray<TWeakObjectPtr<AAIController>> PendingOrder;
+
+	/* 탐색 중인 쿼리 ID → 컨트롤러 */
+	TMap<uint32, TWeakObjectPtr<AAIController>> InFlightQueries;
+
+	/* 이번 프레임 통계 */
+	int32 NumDeduped = 0;
+	int32 NumCompleted = 0;
+	double TotalLatencyMs = 0.0;
+	double MaxLatencyMs = 0.0;
+};
@@ -0,0 +1,186 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PatrolCrowdSubsystem.generated.h"
+
+class AEnemy;
+class APatrolRouteGraph;
+class UInstancedStaticMeshComponent;
+
+/**
+ * 액터에서 프록시로 내려갈 때 보관하고, 다시 액터로 올라갈 때 되돌려 주는 순찰 상태 (자주 읽지 않는 데이터)
+ */
+USTRUCT()
+struct FPatrolCrowdProxyState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> PatrolTargets;
+
+	UPROPERTY()
+	AActor* PatrolTarget = nullptr;
+
+	UPROPERTY()
+	APatrolRouteGraph* PatrolRoute = nullptr;
+
+	int32 PatrolWaypointIndex = INDEX_NONE;
+	int32 PatrolLegIndex = INDEX_NONE;
+
+	/* 걷고 있는 구간의 구운 경로 점 인덱스 (구간이 없으면 INDEX_NONE) */
+	int32 LegPointIndex = INDEX_NONE;
+
+	float Speed = 0.f;
+	float PatrolWaitMin = 0.f;
+	float PatrolWaitMax = 0.f;
+	float Health = 0.f;
+
+	/* (AEnemy::GetDetectionRadius() + PromoteMargin)^2 */
+	double PromoteRadiusSquared = 0.0;
+};
+
+/**
+ * 같은 적 클래스의 프록시 묶음
+ * 인스턴스 메시 한 개로 그리고, 자주 쓰는 데이터는 배열별로 나눠 둡니다. (모든 배열과 인스턴스의 인덱스가 같음)
+ */
+USTRUCT()
+struct FPatrolCrowdGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AEnemy> EnemyClass;
+
+	UPROPERTY(Transient)
+	UInstancedStaticMeshComponent* Instances = nullptr;
+
+	/* 발 위치 기준 프록시 메시 변환 (적 스켈레탈 메시의 상대 변환 + 캡슐 반 높이) */
+	FTransform MeshOffset;
+
+	/* 액터로 올릴 때 발 위치에 더할 높이 */
+	float CapsuleHalfHeight = 0.f;
+
+	/* 발 위치 */
+	TArray<FVector> Locations;
+
+	/* 지금 걸어가는 점 */
+	TArray<FVector> Goals;
+
+	TArray<float> Yaws;
+
+	/* 0 보다 크면 순찰 지점에서 대기 중 */
+	TArray<float> WaitTimes;
+
+	UPROPERTY()
+	TArray<FPatrolCrowdProxyState> States;
+
+	/* 인스턴스 변환 갱신용 (매 프레임 재사용) */
+	TArray<FTransform> InstanceTransforms;
+};
+
+/**
+ * 플레이어와 먼 순찰 중인 적을 가벼운 프록시로 대신하는 서브시스템
+ * 먼 거리의 순찰 적은 순찰 지점 사이를 걷기만 하므로 캐릭터/이동/시야/위젯 컴포넌트 대신
+ * 위치/목표/대기 시간 배열과 적 클래스별 인스턴스 메시 한 개로 이동과 렌더링을 처리합니다.
+ * (인스턴스 커스텀 데이터 0 번에 걷는 중이면 1, 대기 중이면 0 을 넣어 버텍스 애니메이션 머티리얼이 읽을 수 있음)
+ *
+ * 1. 프록시가 플레이어에게 감지 거리(시야 반경과 CombatRadius 중 큰 값) + PromoteMargin 안으로 들어오면 풀에서 AEnemy 를 꺼내 순찰 상태/체력을 옮겨 줌 (승격)
+ * 2. 관심을 잃고 순찰로 돌아간 AEnemy 가 승격 거리 + DemoteHysteresis 밖에 있으면 프록시로 바꾸고 풀로 돌려보냄 (강등)
+ * CrowdProxyMesh 가 지정된 적 클래스 중 PatrolRoute(구운 경로)가 있는 적만 강등됩니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UPatrolCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 적을 강등 후보로 등록합니다. (BeginPlay, 풀에서 꺼낼 때)
+	 * @param Enemy 등록할 적
+	 */
+	void RegisterEnemy(AEnemy* Enemy);
+
+	/**
+	 * 적을 강등 후보에서 제거합니다. (사망, 풀 반환, 파괴 시)
+	 * @param Enemy 제거할 적
+	 */
+	void UnregisterEnemy(AEnemy* Enemy);
+
+	FORCEINLINE int32 GetNumProxies() const { return NumProxies; }
+
+private:
+	/* 프록시 이동, 승격 대상 수집, 인스턴스 변환 갱신 */
+	void UpdateGroup(int32 GroupIndex, float DeltaTime, const FVector& PlayerLocation, bool bHasPlayer);
+
+	/* 순찰 지점에 도착한 프록시의 다음 지점을 고르고 대기 시작 (AEnemy::CheckPatrolTarget 과 같은 규칙) */
+	void ChooseNextPatrolTarget(FPatrolCrowdProxyState& State, float& OutWaitTime) const;
+
+	/* 대기가 끝난 프록시가 걸어갈 첫 점 */
+	FVector GetFirstGoal(FPatrolCrowdProxyState& State, const FVector& Location) const;
+
+	/* 구운 구간 경로의 다음 점으로 넘어갑니다. @return 구간 끝이면 false */
+	bool AdvanceLegGoal(FPatrolCrowdProxyState& State, FVector& OutGoal) const;
+
+	/* 후보 적 중 강등할 적을 골라 프록시로 바꿈 */
+	void DemoteDistantEnemies(const FVector& PlayerLocation);
+
+	void DemoteEnemy(AEnemy* Enemy);
+
+	/* 프록시를 액터로 바꾸고 배열/인스턴스에서 제거 */
+	void PromoteProxy(FPatrolCrowdGroup& Group, int32 Index);
+
+	FPatrolCrowdGroup* FindOrAddGroup(AEnemy* Enemy);
+
+	/* 강등 검사 주기(초) */
+	UPROPERTY(Config)
+	float DemoteCheckInterval = 0.5f;
+
+	/* 적의 감지 거리에 더한 거리 안으로 들어온 프록시를 승격 (프록시는 플레이어를 볼 수 없으므로 감지 거리보다 먼저) */
+	UPROPERTY(Config)
+	float PromoteMargin = 500.f;
+
+	/* 승격 거리에 더한 거리 밖의 순찰 적을 강등 (경계에서 반복해서 오르내리지 않게) */
+	UPROPERTY(Config)
+	float DemoteHysteresis = 1000.f;
+
+	/* 한 프레임에 승격할 최대 수 (액터 활성화 비용 분산) */
+	UPROPERTY(Config)
+	int32 MaxPromotionsPerFrame = 4;
+
+	/* 한 번의 검사에서 강등할 최대 수 */
+	UPROPERTY(Config)
+	int32 MaxDemotionsPerCheck = 8;
+
+	UPROPERTY()
+	TArray<FPatrolCrowdGroup> Groups;
+
+	/* 강등 후보 (CrowdProxyMesh 가 있는 살아있는 적) */
+	UPROPERTY()
+	TArray<AEnemy*> Enemies;
+
+	/* 인스턴스 메시 컴포넌트를 붙여 둘 액터 */
+	UPROPERTY(Transient)
+	AActor* ProxyRenderer = nullptr;
+
+	/* 이번 프레임 승격할 (그룹, 인덱스) (매 프레임 재사용) */
+	TArray<TPair<int32, int32>> PendingPromotions;
+
+	/* 이번 검사에서 강등할 적 (매 검사 재사용) */
+	TArray<AEnemy*> PendingDemotions;
+
+	float TimeSinceDemoteCheck = 0.f;
+	int32 NumProxies = 0;
+};
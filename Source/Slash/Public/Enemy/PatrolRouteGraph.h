@@ -0,0 +1,125 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "PatrolRouteGraph.generated.h"
+
+/**
+ * 순찰 지점 하나에서 다른 지점으로 가는 구간
+ */
+USTRUCT()
+struct FPatrolRouteLeg
+{
+	GENERATED_BODY()
+
+	/* Waypoints 인덱스 */
+	UPROPERTY(VisibleAnywhere)
+	int32 From = INDEX_NONE;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 To = INDEX_NONE;
+
+	/* 같은 출발 지점의 구간들 사이에서 선택될 상대 확률 */
+	UPROPERTY(EditAnywhere, meta = (ClampMin = "0.0"))
+	float Weight = 1.f;
+
+	/* 에디터에서 구워 둔 내비메시 경로 점 (비어 있으면 실행 중 경로 탐색) */
+	UPROPERTY(VisibleAnywhere)
+	TArray<FVector> PathPoints;
+};
+
+/**
+ * 순찰 지점 하나에서 나가는 구간 범위 (Legs 는 From 순으로 정렬되어 있음)
+ */
+USTRUCT()
+struct FPatrolRouteNode
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere)
+	int32 FirstLeg = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	int32 NumLegs = 0;
+
+	UPROPERTY(VisibleAnywhere)
+	float TotalWeight = 0.f;
+};
+
+/**
+ * 레벨에 배치하는 순찰 경로 그래프
+ * 순찰 지점 사이의 연결(구간), 구간별 가중치, 미리 구운 내비메시 경로를 보관하고
+ * 여러 적이 함께 사용합니다. 적은 지점에 도착할 때마다 가중치로 다음 구간을 고르고
+ * 구운 경로를 그대로 따라가므로 할당이나 새 경로 탐색이 없습니다.
+ *
+ * 순찰 지점이 레벨 인스턴스이므로 데이터 에셋이 아닌 레벨 액터로 둡니다.
+ * 에디터에서 "Build From Enemies" 로 이 그래프를 쓰는 적들의 PatrolTargets 로부터 지점/구간을 만들고
+ * "Bake Paths" 로 구간 경로를 구웁니다. (빌드 시 자동으로 굽기까지 수행)
+ */
+UCLASS()
+class SLASH_API APatrolRouteGraph : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	APatrolRouteGraph();
+
+	/**
+	 * PatrolRoute 로 이 그래프를 지정한 레벨의 적들로부터 지점과 구간을 다시 만듭니다.
+	 * 적 하나의 PatrolTargets 안에서 서로 다른 두 지점은 모두 양방향으로 연결됩니다. (기존 무작위 선택과 같은 후보)
+	 */
+	UFUNCTION(CallInEditor, Category = "Patrol Route")
+	void BuildFromEnemies();
+
+	/* 모든 구간의 내비메시 경로를 다시 구웁니다. (내비메시 빌드 후 실행) */
+	UFUNCTION(CallInEditor, Category = "Patrol Route")
+	void BakePaths();
+
+	/**
+	 * 지점 액터의 인덱스를 찾습니다. (BeginPlay 등에서 한 번)
+	 * @return 없으면 INDEX_NONE
+	 */
+	int32 FindWaypointIndex(const AActor* Waypoint) const;
+
+	/**
+	 * 지점에서 나가는 구간 중 하나를 가중치로 고릅니다.
+	 * @return 구간 인덱스, 나가는 구간이 없으면 INDEX_NONE
+	 */
+	int32 ChooseNextLeg(int32 FromWaypoint) const;
+
+	/**
+	 * 구간의 구운 경로를 반환합니다. 구운 경로가 없으면 null
+	 * 같은 구간을 걷는 적들이 경로 객체를 함께 씁니다.
+	 */
+	FNavPathSharedPtr GetLegPath(int32 LegIndex) const;
+
+	FORCEINLINE AActor* GetWaypoint(int32 Index) const { return Waypoints.IsValidIndex(Index) ? Waypoints[Index] : nullptr; }
+	FORCEINLINE const FPatrolRouteLeg& GetLeg(int32 LegIndex) const { return Legs[LegIndex]; }
+	FORCEINLINE bool IsValidLeg(int32 LegIndex) const { return Legs.IsValidIndex(LegIndex); }
+
+protected:
+	virtual void BeginPlay() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/* Legs 를 From 순으로 정렬하고 Nodes 를 다시 계산 */
+	void RebuildNodes();
+
+	UPROPERTY(EditInstanceOnly, Category = "Patrol Route")
+	TArray<AActor*> Waypoints;
+
+	UPROPERTY(EditInstanceOnly, Category = "Patrol Route")
+	TArray<FPatrolRouteLeg> Legs;
+
+	UPROPERTY(VisibleAnywhere, Category = "Patrol Route")
+	TArray<FPatrolRouteNode> Nodes;
+
+	/* 구운 경로로 만든 경로 객체 (BeginPlay 에서 구간마다 한 번) */
+	TArray<FNavPathSharedPtr> LegPaths;
+};
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SightQueryComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSightQuerySeePawn, APawn*, SeenPawn);
+
+/**
+ * 시야 설정만 들고 있는 가벼운 감지 컴포넌트
+ * 실제 시야 판정은 UEnemyPerceptionSubsystem 이 모든 요청을 모아 한 번에 처리하고,
+ * 보인 Pawn 이 있으면 OnSeePawn 으로 알려줍니다. (UPawnSensingComponent 대체)
+ */
+UCLASS(ClassGroup = (AI), meta = (BlueprintSpawnableComponent))
+class SLASH_API USightQueryComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USightQueryComponent();
+
+	/* 좌우 시야각(도), 정면 기준 한쪽 각도 */
+	void SetPeripheralVisionAngle(float NewPeripheralVisionAngle);
+	FORCEINLINE void SetSightRadius(float NewSightRadius) { SightRadius = NewSightRadius; }
+
+	FORCEINLINE float GetSightRadius() const { return SightRadius; }
+	FORCEINLINE float GetPeripheralVisionCosine() const { return PeripheralVisionCosine; }
+	FORCEINLINE float GetSensingInterval() const { return SensingInterval; }
+
+	/* 눈 위치 (소유 액터의 시점 위치) */
+	FVector GetSensorLocation() const;
+
+	/* 바라보는 방향 (소유 액터의 회전) */
+	FVector GetSensorDirection() const;
+
+	/* 감지 서비스 등록/해제 (풀에 들어간 적은 시야 판정에서 제외) */
+	void SetSensingEnabled(bool bEnabled);
+
+	/* 감지 서비스가 시야 판정을 통과한 Pawn 을 전달할 때 호출 */
+	void NotifySeePawn(APawn* SeenPawn);
+
+	/* Pawn 이 시야에 들어왔을 때 호출 */
+	UPROPERTY(BlueprintAssignable)
+	FOnSightQuerySeePawn OnSeePawn;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	/* 최대 시야 거리 */
+	UPROPERTY(EditAnywhere, Category = "AI")
+	float SightRadius = 4000.f;
+
+	/* 시야 판정 주기(초) */
+	UPROPERTY(EditAnywhere, Category = "AI")
+	float SensingInterval = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "AI")
+	float PeripheralVisionAngle = 90.f;
+
+	float PeripheralVisionCosine = 0.f;
+};
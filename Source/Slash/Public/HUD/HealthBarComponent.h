@@ -3,21 +3,34 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Components/WidgetComponent.h"
+#include "Components/SceneComponent.h"
 #include "HealthBarComponent.generated.h"
 
 /**
- * 
+ * 적 머리 위 체력바 위치와 값만 가진 등록용 컴포넌트
+ * 실제 그리기는 UHealthBarSubsystem 에 모인 모든 체력바를 ASlashHUD 가 한 번에 처리합니다.
+ * 컴포넌트의 위치가 체력바의 월드 위치이고, SetVisibility 로 표시 여부를 정합니다.
  */
-UCLASS()
-class SLASH_API UHealthBarComponent : public UWidgetComponent
+UCLASS(ClassGroup = (UI), meta = (BlueprintSpawnableComponent))
+class SLASH_API UHealthBarComponent : public USceneComponent
 {
 	GENERATED_BODY()
 
 public:
+	UHealthBarComponent();
+
 	void SetHealthBarPercent(float Percent);
 
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void OnVisibilityChanged() override;
+
 private:
-	UPROPERTY()
-	class UHealthBar* HealthBarWidget;
+	friend class UHealthBarSubsystem;
+
+	/* UHealthBarSubsystem 배열에서의 위치, 등록되지 않았으면 INDEX_NONE */
+	int32 BarIndex = INDEX_NONE;
+
+	float HealthPercent = 1.f;
 };
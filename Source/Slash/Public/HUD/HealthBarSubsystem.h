@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HealthBarSubsystem.generated.h"
+
+class UHealthBarComponent;
+
+/**
+ * 적 체력바 하나의 그리기 정보
+ */
+struct FHealthBarEntry
+{
+	UHealthBarComponent* Component = nullptr;
+	float HealthPercent = 1.f;
+};
+
+/**
+ * 모든 적 체력바를 연속 배열로 모아 두고 ASlashHUD 가 한 번에 그리게 하는 서브시스템
+ * (적마다 UWidgetComponent 렌더 타깃과 Slate 트리를 두던 방식 대체)
+ * 보이는 체력바는 항상 배열 앞쪽 [0, NumVisible) 에 모여 있으므로 그리기 루프는 보이는 것만 순회합니다.
+ */
+UCLASS()
+class SLASH_API UHealthBarSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	void RegisterBar(UHealthBarComponent* Component, float HealthPercent, bool bVisible);
+	void UnregisterBar(UHealthBarComponent* Component);
+	void SetBarPercent(const UHealthBarComponent* Component, float HealthPercent);
+	void SetBarVisible(UHealthBarComponent* Component, bool bVisible);
+
+	/* 보이는 체력바 목록 (앞쪽 NumVisible 개) */
+	FORCEINLINE TArrayView<const FHealthBarEntry> GetVisibleBars() const { return MakeArrayView(Entries.GetData(), NumVisible); }
+
+private:
+	/* 두 항목의 자리를 바꾸고 컴포넌트의 인덱스를 갱신 */
+	void SwapEntries(int32 First, int32 Second);
+
+	TArray<FHealthBarEntry> Entries;
+
+	int32 NumVisible = 0;
+};
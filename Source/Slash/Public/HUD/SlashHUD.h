@@ -12,14 +12,35 @@ UCLASS()
 class SLASH_API ASlashHUD : public AHUD
 {
 	GENERATED_BODY()
+public:
+	virtual void DrawHUD() override;
 protected:
 	virtual void BeginPlay() override;
 private:
+	/**
+	 * UHealthBarSubsystem 에 모인 보이는 적 체력바를 한 번에 그립니다.
+	 */
+	void DrawEnemyHealthBars();
+
 	UPROPERTY(EditDefaultsOnly, Category = Slash)
 	TSubclassOf<USlashOverlay> SlashOverlayClass;
 
 	UPROPERTY()
 	USlashOverlay* SlashOverlay;
+
+	/* 적 체력바 크기(픽셀) */
+	UPROPERTY(EditDefaultsOnly, Category = "Slash|Health Bar")
+	FVector2D HealthBarSize = FVector2D(80.f, 8.f);
+
+	UPROPERTY(EditDefaultsOnly, Category = "Slash|Health Bar")
+	FLinearColor HealthBarBackgroundColor = FLinearColor(0.f, 0.f, 0.f, 0.6f);
+
+	UPROPERTY(EditDefaultsOnly, Category = "Slash|Health Bar")
+	FLinearColor HealthBarFillColor = FLinearColor(0.8f, 0.05f, 0.05f, 1.f);
+
+	/* 카메라에서 이 거리보다 먼 체력바는 그리지 않음 */
+	UPROPERTY(EditDefaultsOnly, Category = "Slash|Health Bar")
+	float HealthBarMaxDrawDistance = 5000.f;
 public:
 	FORCEINLINE USlashOverlay* GetSlashOverlay() const { return SlashOverlay; }
-};
\ No newline at end of file
+};
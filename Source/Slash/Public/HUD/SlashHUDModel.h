@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 오버레이에 표시할 값과 변경 여부(더티 플래그)를 담는 HUD 모델
+ * UAttributeComponent 의 변경 이벤트로 값을 받고, 오버레이가 프레임마다 한 번 더티 값만 위젯에 반영합니다.
+ * 같은 값이 다시 들어오면 더티로 표시하지 않으므로 위젯 갱신과 문자열 생성이 일어나지 않습니다.
+ */
+struct FSlashHUDModel
+{
+	enum EDirtyFlags : uint8
+	{
+		DF_None = 0,
+		DF_Health = 1 << 0,
+		DF_Stamina = 1 << 1,
+		DF_Gold = 1 << 2,
+		DF_Souls = 1 << 3,
+		DF_All = DF_Health | DF_Stamina | DF_Gold | DF_Souls
+	};
+
+	float HealthPercent = 1.f;
+	float StaminaPercent = 1.f;
+	int32 Gold = 0;
+	int32 Souls = 0;
+
+	/* 마지막 반영 이후 바뀐 값 (EDirtyFlags 조합) */
+	uint8 DirtyFlags = DF_All;
+
+	void SetHealthPercent(float Percent) { SetValue(HealthPercent, Percent, DF_Health); }
+	void SetStaminaPercent(float Percent) { SetValue(StaminaPercent, Percent, DF_Stamina); }
+	void SetGold(int32 NewGold) { SetValue(Gold, NewGold, DF_Gold); }
+	void SetSouls(int32 NewSouls) { SetValue(Souls, NewSouls, DF_Souls); }
+
+	FORCEINLINE bool IsDirty(EDirtyFlags Flag) const { return (DirtyFlags & Flag) != 0; }
+	FORCEINLINE void ClearDirty() { DirtyFlags = DF_None; }
+
+private:
+	template<typename T>
+	void SetValue(T& Value, T NewValue, EDirtyFlags Flag)
+	{
+		if (Value != NewValue)
+		{
+			Value = NewValue;
+			DirtyFlags |= Flag;
+		}
+	}
+};
@@ -4,10 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "HUD/SlashHUDModel.h"
 #include "SlashOverlay.generated.h"
 
+class UAttributeComponent;
+enum class EAttributeType : uint8;
+
 /**
- * 
+ * 체력/스태미나/골드/영혼을 표시하는 오버레이
+ * 속성 변경 이벤트는 HUD 모델에만 기록하고, NativeTick 에서 프레임당 한 번 바뀐 값만 위젯에 반영합니다.
  */
 UCLASS()
 class SLASH_API USlashOverlay : public UUserWidget
@@ -15,12 +20,27 @@ class SLASH_API USlashOverlay : public UUserWidget
 	GENERATED_BODY()
 public:
 
-	void SetHealthBarPercent(float Percent);
-	void SetStaminaBarPercent(float Percent);
-	void SetGold(int32 Gold);
-	void SetSouls(int32 Souls);
+	/**
+	 * 속성 컴포넌트의 변경 이벤트를 구독하고 현재 값으로 모델을 채웁니다.
+	 * @param Attribute 표시할 속성 컴포넌트 (nullptr 이면 구독만 해제)
+	 */
+	void BindAttributes(UAttributeComponent* Attribute);
+
+protected:
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual void NativeDestruct() override;
 
 private:
+	void OnAttributeChanged(UAttributeComponent* Attribute, EAttributeType Type);
+
+	/* 모델의 더티 값을 위젯에 반영 */
+	void FlushModel();
+
+	FSlashHUDModel Model;
+
+	TWeakObjectPtr<UAttributeComponent> BoundAttribute;
+	FDelegateHandle AttributeChangedHandle;
+
 	UPROPERTY(meta = (BindWidget))
 	class UProgressBar* HealthProgressBar;
 
@@ -32,4 +52,4 @@ private:
 
 	UPROPERTY(meta = (BindWidget))
 	class UTextBlock* SoulsText;
-};
\ No newline at end of file
+};
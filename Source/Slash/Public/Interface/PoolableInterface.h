@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "PoolableInterface.generated.h"
+
+UINTERFACE(MinimalAPI)
+class UPoolableInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * UActorPoolSubsystem 에서 재사용되는 액터가 구현하는 인터페이스
+ * 파괴/생성 대신 Deactivate 로 풀에 돌아가고 Activate 로 다시 꺼내집니다.
+ */
+class SLASH_API IPoolableInterface
+{
+	GENERATED_BODY()
+public:
+	/* 풀에서 꺼내졌을 때 (보이기, 충돌/틱 활성화) */
+	virtual void Activate();
+
+	/* 풀로 돌아갈 때 (숨기기, 충돌/틱 비활성화) */
+	virtual void Deactivate();
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Interface/PoolableInterface.h"
 #include "Item.generated.h"
 
 class USphereComponent;
@@ -20,16 +21,21 @@ enum class EItemState : uint8
 };
 
 UCLASS()
-class SLASH_API AItem : public AActor
+class SLASH_API AItem : public AActor, public IPoolableInterface
 {
 	GENERATED_BODY()
 
 public:	
 	AItem();
-	virtual void Tick(float DeltaTime) override;
+
+	/* <IPoolableInterface> */
+	virtual void Activate() override;
+	virtual void Deactivate() override;
+	/* </IPoolableInterface> */
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sine Parameters")
 	float Amplitude = 0.25f;
@@ -69,13 +75,24 @@ protected:
 
 	virtual void SpawnPickupSystem();
 	virtual void SpawnPickupSound();
+
+	/* 주워진 아이템을 풀로 돌려보냅니다. 풀이 없으면 파괴합니다. */
+	void ReturnToPool();
 	
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UStaticMeshComponent* ItemMesh;
+
+	/* 떠 있는 동안 ItemMesh 대신 그려지는 충돌 없는 메시, 흔들림은 이 메시의 상대 위치로만 표현 */
+	UPROPERTY(VisibleAnywhere)
+	UStaticMeshComponent* HoverMesh;
 	
 	EItemState ItemState = EItemState::EIS_Hovering;
 
+	/* 떠 있는 아이템을 UItemHoverSubsystem 에 등록/해제 */
+	void StartHovering();
+	void StopHovering();
+
 	UPROPERTY(EditAnywhere)
 	UNiagaraComponent* ItemEffect;
 
@@ -83,8 +100,13 @@ protected:
 	USoundBase* PickupSound;
 
 private:
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
-	float RunningTime;
+	friend class UItemHoverSubsystem;
+
+	/* UItemHoverSubsystem 배열에서의 위치, 등록되지 않았으면 INDEX_NONE */
+	int32 HoverIndex = INDEX_NONE;
+
+	/* 흔들림 높이를 HoverMesh 에 반영 (자식인 ItemEffect 도 함께 움직임) */
+	void ApplyHoverOffset(float Offset);
 
 	UPROPERTY(EditAnywhere)
 	class UNiagaraSystem* PickupEffect;
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemHoverSubsystem.generated.h"
+
+class AItem;
+
+/**
+ * 바닥에 떠 있는 아이템의 위아래 흔들림을 한 곳에서 처리하는 서브시스템 (AItem::Tick 대체)
+ * 1. 모든 아이템의 시간/누적 오프셋을 연속 배열에서 한 번에 계산
+ * 2. 최근 화면에 그려진 아이템만 누적 오프셋을 충돌 없는 시각용 자식(AItem::HoverMesh)의 상대 위치로 넘김
+ * 액터 루트는 움직이지 않으므로 Sphere 겹침 갱신과 공간 해시 갱신이 일어나지 않습니다.
+ * 화면 밖 아이템은 오프셋이 쌓여 있다가 다시 보일 때 한 번에 반영되므로 기존 위치 궤적과 같습니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UItemHoverSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/* <FTickableGameObject> */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/* </FTickableGameObject> */
+
+	/**
+	 * 떠 있는 아이템을 등록합니다. 이미 등록된 아이템은 무시합니다.
+	 * @param Item 흔들림을 적용할 아이템
+	 */
+	void RegisterItem(AItem* Item);
+
+	/**
+	 * 아이템 등록을 해제합니다. (장착, 줍기, 풀 반환, 파괴)
+	 * @param Item 해제할 아이템
+	 */
+	void UnregisterItem(AItem* Item);
+
+	/**
+	 * 아이템이 등록된 뒤 흐른 시간을 반환합니다. 등록되지 않았으면 0
+	 */
+	float GetRunningTime(const AItem* Item) const;
+
+	FORCEINLINE int32 GetNumItems() const { return Items.Num(); }
+
+private:
+	void RemoveAt(int32 Index);
+
+	/* 마지막 렌더 후 이 시간(초) 안이면 HoverMesh 위치를 갱신 */
+	UPROPERTY(Config)
+	float VisibleRenderTime = 0.2f;
+
+	UPROPERTY()
+	TArray<AItem*> Items;
+
+	/* Items 와 같은 인덱스를 쓰는 연속 배열 */
+	TArray<float> RunningTimes;
+	TArray<float> Amplitudes;
+	TArray<float> TimeConstants;
+	TArray<float> Offsets;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Item/Item.h"
+#include "WorldCollision.h"
 #include "Weapon.generated.h"
 
 class USoundBase;
@@ -24,6 +25,53 @@ public:
 	void PlayEquipSound();
 	void AttachMeshToSocket(USceneComponent* InParent, const FName& InSocketName);
 
+	/**
+	 * 한 번의 휘두르기 동안 맞은 액터 목록을 비우고 휘두르기 번호를 올립니다. (휘두르기 시작 시)
+	 * 이전 휘두르기에서 제출돼 아직 결과를 기다리는 트레이스는 번호가 달라 버려집니다.
+	 */
+	void ResetIgnoreActors();
+
+	/* 지금 휘두르기의 번호 (비동기 트레이스 결과가 같은 휘두르기의 것인지 확인) */
+	FORCEINLINE uint32 GetSwingId() const { return SwingId; }
+
+	/**
+	 * BoxTraceStarts ~ BoxTraceEnds 구간의 박스 스윕을 비동기로 제출합니다.
+	 * UWeaponTraceSubsystem 이 모아둔 요청을 처리할 때 호출합니다.
+	 * @return 다음 프레임에 결과를 조회할 트레이스 핸들
+	 */
+	FTraceHandle SubmitBoxTrace(UWorld* World);
+
+	/**
+	 * 지정한 칼날 위치로 박스 스윕을 비동기로 제출합니다.
+	 * @return 다음 프레임에 결과를 조회할 트레이스 핸들
+	 */
+	FTraceHandle SubmitBoxSweep(UWorld* World, const FVector& Start, const FVector& End, const FQuat& Rotation);
+
+	/**
+	 * 칼날 전체 길이를 덮는 박스를 이전 칼날 위치에서 다음 칼날 위치까지 스윕합니다. (스윕 모드)
+	 * 두 위치의 칼날이 만드는 사각형을 박스 하나로 근사합니다. 박스 방향은 두 칼날의 평균 방향으로 고정되므로
+	 * 회전량이 큰 구간은 UWeaponTraceSubsystem 이 여러 번으로 나눠 호출해야 빈틈이 작아집니다.
+	 * @return 다음 프레임에 결과를 조회할 트레이스 핸들
+	 */
+	FTraceHandle SubmitBladeSweep(UWorld* World, const FVector& FromStart, const FVector& FromEnd, const FVector& ToStart, const FVector& ToEnd);
+
+	/* 현재 칼날의 시작/끝 위치와 회전 */
+	void GetBladeTransform(FVector& OutStart, FVector& OutEnd, FQuat& OutRotation) const;
+
+	/**
+	 * 공격 몽타주의 노티파이 창(무기 충돌 활성화)에 맞춰 휘두르기 구간을 시작/종료합니다.
+	 * 스윕 모드가 아니면 아무것도 하지 않습니다.
+	 */
+	void BeginSwing();
+	void EndSwing();
+
+	/**
+	 * 비동기 박스 트레이스 결과로 데미지 이벤트를 UDamageQueueSubsystem 에 넣습니다.
+	 * 이번 휘두르기에서 이미 맞은 액터는 무시합니다.
+	 * @param BoxHit 트레이스 결과
+	 */
+	void ResolveBoxHit(const FHitResult& BoxHit);
+
 	TArray<AActor*> IgnoreActors;
 protected:
 	virtual void BeginPlay() override;
@@ -33,13 +81,20 @@ protected:
 
 	bool ActorIsSameType(AActor* OtherActor);
 
-	void ExecuteGetHit(FHitResult& BoxHit);
+	void ExecuteGetHit(const FHitResult& BoxHit);
 
 	UFUNCTION(BlueprintImplementableEvent)
 	void CreateFields(const FVector& FieldLocation);
 private:
 
-	void BoxTrace(FHitResult& BoxHit);
+	/* 자신과 소유자만 무시하도록 박스 트레이스 쿼리 설정을 초기화 */
+	void ResetBoxTraceParams();
+
+	/* 휘두르기마다 재사용하는 박스 트레이스 쿼리 설정 (맞은 액터는 누적해서 무시) */
+	FCollisionQueryParams BoxTraceParams;
+
+	/* ResetIgnoreActors 마다 1 씩 증가 */
+	uint32 SwingId = 0;
 
 	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
 	FVector BoxTraceExtent = FVector(5.f);
@@ -62,6 +117,20 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
 	float Damage = 20.f;
 
+	/* 겹침 순간 한 번이 아니라 휘두르기 구간 동안 칼날 궤적을 따라 스윕 (기존 무기는 겹침 모드 유지) */
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties")
+	bool bUseSweptTrace = false;
+
+	/* 한 프레임에 보간할 최대 스윕 횟수 */
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties", meta = (ClampMin = "1"))
+	int32 MaxSweepSubsteps = 4;
+
+	/* 스윕 한 번이 담당할 최대 칼날 회전각(도) */
+	UPROPERTY(EditAnywhere, Category = "Weapon Properties", meta = (ClampMin = "1.0"))
+	float MaxDegreesPerSweep = 15.f;
+
 public:
 	FORCEINLINE UBoxComponent* GetWeaponBox() const { return WeaponBox; }
+	FORCEINLINE int32 GetMaxSweepSubsteps() const { return FMath::Max(MaxSweepSubsteps, 1); }
+	FORCEINLINE float GetMaxDegreesPerSweep() const { return FMath::Max(MaxDegreesPerSweep, 1.f); }
 };
\ No newline at end of file
@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+/**
+ * 월드 시작 시 미리 만들어 둘 액터 클래스와 개수 (DefaultGame.ini)
+ */
+USTRUCT()
+struct FActorPoolPrewarm
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Config)
+	TSoftClassPtr<AActor> ActorClass;
+
+	UPROPERTY(Config)
+	int32 Count = 0;
+};
+
+/**
+ * 클래스 하나에 대한 풀 (쉬고 있는 액터 목록)
+ */
+USTRUCT()
+struct FActorPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> FreeActors;
+};
+
+/**
+ * 액터를 파괴하지 않고 재사용하는 범용 풀
+ * IPoolableInterface 를 구현한 액터는 Release 시 Deactivate 되어 보관되고, Acquire 시 Activate 되어 다시 쓰입니다.
+ * 스포너/레벨 블루프린트는 SpawnActor 대신 AcquireActor 로 적을 다시 배치합니다.
+ * 풀이 비어 있을 때만 SpawnActor 를 호출하므로 stat SlashPool 의 생성/재사용/보관 수로 전투 중 실제 생성 횟수를 확인할 수 있습니다.
+ */
+UCLASS(Config = Game)
+class SLASH_API UActorPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/* <UWorldSubsystem> */
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	/* </UWorldSubsystem> */
+
+	/**
+	 * 풀에서 액터를 꺼내 지정한 위치에 배치합니다. 풀이 비어 있으면 새로 생성합니다.
+	 * @param Class 꺼낼 액터 클래스
+	 * @param Transform 배치할 위치/회전
+	 * @return 활성화된 액터, 실패 시 nullptr
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pool", meta = (DeterminesOutputType = "Class"))
+	AActor* AcquireActor(TSubclassOf<AActor> Class, const FTransform& Transform);
+
+	template<typename T>
+	T* Acquire(TSubclassOf<T> Class, const FTransform& Transform);
+
+	/**
+	 * 액터를 풀로 돌려보냅니다. IPoolableInterface 를 구현하지 않은 액터는 파괴합니다.
+	 * @param Actor 돌려보낼 액터
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	void Release(AActor* Actor);
+
+	/**
+	 * Class 의 쉬고 있는 액터가 Count 개가 되도록 미리 생성합니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pool")
+	void Prewarm(TSubclassOf<AActor> Class, int32 Count);
+
+	/* SpawnActor 로 새로 만든 총 횟수 */
+	FORCEINLINE int32 GetNumSpawned() const { return NumSpawned; }
+
+	/* 풀에서 재사용한 총 횟수 */
+	FORCEINLINE int32 GetNumReused() const { return NumReused; }
+
+private:
+	AActor* SpawnPooledActor(UClass* Class, const FTransform& Transform);
+
+	UPROPERTY(Config)
+	TArray<FActorPoolPrewarm> PrewarmClasses;
+
+	UPROPERTY()
+	TMap<UClass*, FActorPoolBucket> Buckets;
+
+	int32 NumSpawned = 0;
+	int32 NumReused = 0;
+	int32 NumFree = 0;
+};
+
+template<typename T>
+inline T* UActorPoolSubsystem::Acquire(TSubclassOf<T> Class, const FTransform& Transform)
+{
+	return Cast<T>(AcquireActor(Class.Get(), Transform));
+}
@@ -4,3 +4,14 @@
 
 #include "CoreMinimal.h"
 
+/* stat SlashAI 로 확인하는 적 AI 성능 지표 */
+DECLARE_STATS_GROUP(TEXT("SlashAI"), STATGROUP_SlashAI, STATCAT_Advanced);
+
+/* stat SlashCombat 로 확인하는 전투 관련 성능 지표 */
+DECLARE_STATS_GROUP(TEXT("SlashCombat"), STATGROUP_SlashCombat, STATCAT_Advanced);
+
+/* stat SlashPool 로 확인하는 액터 풀 지표 */
+DECLARE_STATS_GROUP(TEXT("SlashPool"), STATGROUP_SlashPool, STATCAT_Advanced);
+
+/* stat SlashItem 으로 확인하는 아이템 지표 */
+DECLARE_STATS_GROUP(TEXT("SlashItem"), STATGROUP_SlashItem, STATCAT_Advanced);